@@ -1 +1,3 @@
 g++ -std=c++14 -pthread msetl_example.cpp msetl_example2.cpp msetl_example3.cpp -o msetl_example.gpp_run
+g++ -std=c++14 -pthread -DMSE_MSTDVECTOR_DISABLED -DMSE_DISABLE_RAW_POINTER_SCOPE_RESTRICTIONS msetl_example.cpp msetl_example2.cpp msetl_example3.cpp -o msetl_example_mstdvector_disabled.gpp_run
+g++ -std=c++14 -pthread -DMSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST -DMSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION -DMSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER -DMSE_SALLOC_REGISTRY_STATS msetl_example.cpp msetl_example2.cpp msetl_example3.cpp -o msetl_example_alternative_implementations.gpp_run
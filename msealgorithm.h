@@ -365,8 +365,8 @@ namespace mse {
 			c_sort(const _RanIt& _First, const _RanIt& _Last) { eval(_First, _Last); }
 		private:
 			static void eval(const _RanIt& _First, const _RanIt& _Last) {
-				const auto xs_iters = TXScopeSpecializedFirstAndLast<_RanIt>(_First, _Last);
-				std::sort(xs_iters.first(), xs_iters.first());
+				const auto xs_iters = make_xscope_specialized_first_and_last(_First, _Last);
+				std::sort(xs_iters.first(), xs_iters.last());
 			}
 		};
 
@@ -392,6 +392,81 @@ namespace mse {
 	}
 
 
+	/* copy() and transform() */
+
+	namespace impl {
+		/* If the destination iterator type also supports "specialized" (raw pointer) first and last iterators, then the
+		destination range is bounds checked once and the algorithm is handed a raw pointer for the destination as well. */
+		template<class _OutIt>
+		class TXScopeSpecializedDest {
+		public:
+			TXScopeSpecializedDest(const _OutIt& _Dest, std::ptrdiff_t _Count) : m_dest_last(_Dest + _Count)
+				, m_specialized_first_and_last(make_xscope_specialized_first_and_last(_Dest, m_dest_last)) {}
+			const auto& first() const { return m_specialized_first_and_last.first(); }
+			const _OutIt& original_last() const { return m_dest_last; }
+
+		private:
+			_OutIt m_dest_last;
+			decltype(make_xscope_specialized_first_and_last(std::declval<_OutIt>(), std::declval<_OutIt>())) m_specialized_first_and_last;
+		};
+
+		template<class _InIt, class _OutIt, class _Fn>
+		class c_transform {
+		public:
+			typedef _OutIt result_type;
+			result_type result;
+			c_transform(const _InIt& _First, const _InIt& _Last, _OutIt _Dest, _Fn _Func) : result(eval(_First, _Last, _Dest, _Func)) {}
+		private:
+			static result_type eval(const _InIt& _First, const _InIt& _Last, _OutIt _Dest, _Fn _Func) {
+				const auto xs_iters = make_xscope_specialized_first_and_last(_First, _Last);
+				return eval_helper1(typename IsSupportedByMakeXScopeSpecializedFirstAndLastOverloaded<_OutIt>::type(), xs_iters.first(), xs_iters.last(), _Dest, _Func);
+			}
+			template<class _InIt2>
+			static result_type eval_helper1(std::true_type, const _InIt2& _First, const _InIt2& _Last, _OutIt _Dest, _Fn _Func) {
+				const auto xs_dest = TXScopeSpecializedDest<_OutIt>(_Dest, std::ptrdiff_t(std::distance(_First, _Last)));
+				std::transform(_First, _Last, xs_dest.first(), _Func);
+				return xs_dest.original_last();
+			}
+			template<class _InIt2>
+			static result_type eval_helper1(std::false_type, const _InIt2& _First, const _InIt2& _Last, _OutIt _Dest, _Fn _Func) {
+				return std::transform(_First, _Last, _Dest, _Func);
+			}
+		};
+
+		template<class _InIt, class _OutIt>
+		class c_copy {
+		public:
+			typedef _OutIt result_type;
+			result_type result;
+			c_copy(const _InIt& _First, const _InIt& _Last, _OutIt _Dest) : result(eval(_First, _Last, _Dest)) {}
+		private:
+			static result_type eval(const _InIt& _First, const _InIt& _Last, _OutIt _Dest) {
+				const auto xs_iters = make_xscope_specialized_first_and_last(_First, _Last);
+				return eval_helper1(typename IsSupportedByMakeXScopeSpecializedFirstAndLastOverloaded<_OutIt>::type(), xs_iters.first(), xs_iters.last(), _Dest);
+			}
+			template<class _InIt2>
+			static result_type eval_helper1(std::true_type, const _InIt2& _First, const _InIt2& _Last, _OutIt _Dest) {
+				const auto xs_dest = TXScopeSpecializedDest<_OutIt>(_Dest, std::ptrdiff_t(std::distance(_First, _Last)));
+				std::copy(_First, _Last, xs_dest.first());
+				return xs_dest.original_last();
+			}
+			template<class _InIt2>
+			static result_type eval_helper1(std::false_type, const _InIt2& _First, const _InIt2& _Last, _OutIt _Dest) {
+				return std::copy(_First, _Last, _Dest);
+			}
+		};
+	}
+	template<class _InIt, class _OutIt>
+	inline _OutIt copy(const _InIt& _First, const _InIt& _Last, _OutIt _Dest) {
+		return impl::c_copy<_InIt, _OutIt>(_First, _Last, _Dest).result;
+	}
+
+	template<class _InIt, class _OutIt, class _Fn>
+	inline _OutIt transform(const _InIt& _First, const _InIt& _Last, _OutIt _Dest, _Fn _Func) {
+		return impl::c_transform<_InIt, _OutIt, _Fn>(_First, _Last, _Dest, _Func).result;
+	}
+
+
 	/* equal() */
 
 	namespace impl {
@@ -27,6 +27,12 @@
 #include <vector>
 #include <future>
 #include <map>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <algorithm>
 
 #if defined(MSE_SAFER_SUBSTITUTES_DISABLED) || defined(MSE_SAFERPTR_DISABLED)
 #define MSE_ASYNCSHAREDPOINTER_DISABLED
@@ -2138,6 +2144,7 @@ namespace mse {
 	template <typename _TExclusiveWritelockPtr> class TAsyncRASectionSplitterXWP;
 	template <typename _TRAIterator> class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
 	template <typename _TRAIterator> class TAsyncSplitterRASectionReadWriteAccessRequester;
+	template <typename _TExclusiveWritelockPtr, size_t N> class TXScopeAsyncNWayRASectionSplitterXWP;
 
 	template <typename _TRAIterator>
 	class TXScopeAsyncSplitterRandomAccessSection : public TXScopeRandomAccessSection<_TRAIterator>
@@ -2171,6 +2178,8 @@ namespace mse {
 
 		template <typename _TExclusiveWritelockPtr>
 		friend class TXScopeAsyncRASectionSplitterXWP;
+		template <typename _TExclusiveWritelockPtr, size_t N>
+		friend class TXScopeAsyncNWayRASectionSplitterXWP;
 		template <typename _TRAIterator2>
 		friend class TXScopeAsyncSplitterRASectionReadWriteAccessRequester;
 		template<class _Ty, class _TAccessMutex/* = non_thread_safe_recursive_shared_timed_mutex*/>
@@ -2333,6 +2342,8 @@ namespace mse {
 
 		template <typename _TExclusiveWritelockPtr>
 		friend class TXScopeAsyncRASectionSplitterXWP;
+		template <typename _TExclusiveWritelockPtr, size_t N>
+		friend class TXScopeAsyncNWayRASectionSplitterXWP;
 	};
 
 	template <typename _TRAIterator>
@@ -2438,29 +2449,41 @@ namespace mse {
 		template<typename _TList>
 		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
 			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr))) {
+			size_t total_size = 0;
+			size_t num_sections = 0;
+			for (const auto& section_size : section_sizes) {
+				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeAsyncRASectionSplitterXWP() - TXScopeAsyncRASectionSplitterXWP")); }
+				total_size += mse::msev_as_a_size_t(section_size);
+				num_sections += 1;
+			}
+			if (m_access_lease_obj_shptr->cref()->size() > total_size) {
+				num_sections += 1;
+			}
+			/* The access requesters hold pointers to the section objects, so the section storage must not be reallocated
+			once it's populated. */
+			m_splitter_aco_ra_sections.reserve(num_sections);
+			m_ra_section_ars.reserve(num_sections);
+
 			size_t cummulative_size = 0;
-			size_t count = 0;
 			//auto section_begin_it = m_access_lease_obj_shptr->cref()->begin();
 			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
 
 			for (const auto& section_size : section_sizes) {
-				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeAsyncRASectionSplitterXWP() - TXScopeAsyncRASectionSplitterXWP")); }
 				auto section_size_szt = mse::msev_as_a_size_t(section_size);
 
 				strong_ra_iterator_t it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(it1, section_size_szt));
-				m_ra_section_ar_map.emplace(count, mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t>(res1.first->second.exclusive_pointer()));
+				m_splitter_aco_ra_sections.emplace_back(it1, section_size_szt);
+				m_ra_section_ars.push_back(xscope_ras_ar_t(m_splitter_aco_ra_sections.back().exclusive_pointer()));
 
 				cummulative_size += section_size_szt;
 				section_begin_it += section_size_szt;
-				count += 1;
 			}
 			if (m_access_lease_obj_shptr->cref()->size() > cummulative_size) {
 				auto section_size = m_access_lease_obj_shptr->cref()->size() - cummulative_size;
 				auto section_size_szt = mse::msev_as_a_size_t(section_size);
 				auto it1 = mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(it1, section_size_szt));
-				m_ra_section_ar_map.emplace(count, mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t>(res1.first->second.exclusive_pointer()));
+				m_splitter_aco_ra_sections.emplace_back(it1, section_size_szt);
+				m_ra_section_ars.push_back(xscope_ras_ar_t(m_splitter_aco_ra_sections.back().exclusive_pointer()));
 			}
 		}
 		TXScopeAsyncRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
@@ -2470,22 +2493,22 @@ namespace mse {
 		}
 
 		xscope_ras_ar_t xscope_ra_section_access_requester(size_t index) const {
-			return m_ra_section_ar_map.at(index);
+			return m_ra_section_ars.at(index);
 		}
 		xscope_ras_ar_t xscope_first_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(0);
+			return m_ra_section_ars.at(0);
 		}
 		xscope_ras_ar_t xscope_second_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(1);
+			return m_ra_section_ars.at(1);
 		}
 		xscope_ras_ar_t ra_section_access_requester(size_t index) const {
-			return m_ra_section_ar_map.at(index);
+			return m_ra_section_ars.at(index);
 		}
 		xscope_ras_ar_t first_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(0);
+			return m_ra_section_ars.at(0);
 		}
 		xscope_ras_ar_t second_ra_section_access_requester() const {
-			return m_ra_section_ar_map.at(1);
+			return m_ra_section_ars.at(1);
 		}
 	private:
 		TXScopeAsyncRASectionSplitterXWP(const TXScopeAsyncRASectionSplitterXWP& src) = delete;
@@ -2494,8 +2517,8 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
 		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
-		std::unordered_map<size_t, xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_section_map;
-		std::unordered_map<size_t, xscope_ras_ar_t> m_ra_section_ar_map;
+		std::vector<xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_sections;
+		std::vector<xscope_ras_ar_t> m_ra_section_ars;
 	};
 
 #ifdef MSE_HAS_CXX17
@@ -2504,6 +2527,88 @@ namespace mse {
 	TXScopeAsyncRASectionSplitterXWP(_TExclusiveWritelockPtr)->TXScopeAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr>;
 #endif /* MSE_HAS_CXX17 */
 
+	/* TXScopeAsyncNWayRASectionSplitterXWP<> is like TXScopeAsyncRASectionSplitterXWP<>, except that it splits the
+	container into a number, N, of sections known at compile-time. The sections are of (nearly) equal size, and they and
+	their access requesters are stored in std::arrays, so no allocation is needed per section. */
+	template <typename _TExclusiveWritelockPtr, size_t N>
+	class TXScopeAsyncNWayRASectionSplitterXWP : public mse::us::impl::XScopeTagBase {
+	public:
+		static_assert(1 <= N, "the number of sections must be at least one - TXScopeAsyncNWayRASectionSplitterXWP");
+
+		typedef _TExclusiveWritelockPtr exclusive_writelock_ptr_t;
+		typedef typename std::remove_reference<decltype(*(std::declval<exclusive_writelock_ptr_t>()))>::type _TContainer;
+		typedef typename std::remove_reference<decltype(std::declval<_TContainer>()[0])>::type element_t;
+		typedef mse::TRAIterator<mse::us::impl::TPointerForLegacy<_TContainer> > ra_iterator_t;
+		typedef decltype(mse::us::impl::make_strong_iterator(std::declval<ra_iterator_t>(), std::declval<std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > >())) strong_ra_iterator_t;
+		typedef mse::TXScopeAsyncSplitterRandomAccessSection<strong_ra_iterator_t> xscope_splitter_ra_section_t;
+		typedef decltype(std::declval<xscope_splitter_ra_section_t>().size()) size_type;
+		typedef mse::TXScopeAccessControlledObj<xscope_splitter_ra_section_t> xscope_aco_splitter_ra_section_t;
+		typedef decltype(std::declval<xscope_aco_splitter_ra_section_t>().exclusive_pointer()) aco_exclusive_pointer_t;
+		typedef mse::TXScopeAsyncSplitterRASectionReadWriteAccessRequester<aco_exclusive_pointer_t> xscope_ras_ar_t;
+
+		TXScopeAsyncNWayRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr)
+			: m_access_lease_obj_shptr(std::make_shared<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> >(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr)))
+			, m_splitter_aco_ra_sections(make_splitter_aco_ra_sections(std::make_index_sequence<N>()))
+			, m_ra_section_ars(make_ra_section_ars(std::make_index_sequence<N>())) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TXScopeAsyncNWayRASectionSplitterXWP() {
+			mse::impl::is_valid_if_exclusive_pointer<exclusive_writelock_ptr_t>::no_op();
+		}
+
+		static constexpr size_t number_of_sections() { return N; }
+
+		xscope_ras_ar_t xscope_ra_section_access_requester(size_t index) const {
+			return m_ra_section_ars.at(index);
+		}
+		xscope_ras_ar_t xscope_first_ra_section_access_requester() const {
+			return m_ra_section_ars.at(0);
+		}
+		xscope_ras_ar_t xscope_second_ra_section_access_requester() const {
+			return m_ra_section_ars.at(1);
+		}
+		xscope_ras_ar_t ra_section_access_requester(size_t index) const {
+			return m_ra_section_ars.at(index);
+		}
+		xscope_ras_ar_t first_ra_section_access_requester() const {
+			return m_ra_section_ars.at(0);
+		}
+		xscope_ras_ar_t second_ra_section_access_requester() const {
+			return m_ra_section_ars.at(1);
+		}
+	private:
+		/* The first (container size % N) sections get one extra element. */
+		size_t section_offset(size_t index) const {
+			const size_t container_size = m_access_lease_obj_shptr->cref()->size();
+			return index * (container_size / N) + std::min(index, container_size % N);
+		}
+		size_t section_size(size_t index) const {
+			const size_t container_size = m_access_lease_obj_shptr->cref()->size();
+			return (container_size / N) + ((container_size % N > index) ? 1 : 0);
+		}
+		strong_ra_iterator_t section_begin_iter(size_t index) const {
+			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj_shptr->cref())));
+			section_begin_it += section_offset(index);
+			return mse::us::impl::make_strong_iterator(section_begin_it, m_access_lease_obj_shptr);
+		}
+		template<size_t... Is>
+		std::array<xscope_aco_splitter_ra_section_t, N> make_splitter_aco_ra_sections(std::index_sequence<Is...>) const {
+			return std::array<xscope_aco_splitter_ra_section_t, N>{ { xscope_aco_splitter_ra_section_t(section_begin_iter(Is), section_size(Is))... } };
+		}
+		/* Must only be called after m_splitter_aco_ra_sections has been initialized. */
+		template<size_t... Is>
+		std::array<xscope_ras_ar_t, N> make_ra_section_ars(std::index_sequence<Is...>) {
+			return std::array<xscope_ras_ar_t, N>{ { xscope_ras_ar_t(m_splitter_aco_ra_sections[Is].exclusive_pointer())... } };
+		}
+
+		TXScopeAsyncNWayRASectionSplitterXWP(const TXScopeAsyncNWayRASectionSplitterXWP& src) = delete;
+		TXScopeAsyncNWayRASectionSplitterXWP(TXScopeAsyncNWayRASectionSplitterXWP&& src) = delete;
+		TXScopeAsyncNWayRASectionSplitterXWP & operator=(const TXScopeAsyncNWayRASectionSplitterXWP& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+
+		std::shared_ptr<TSplitterAccessLeaseObj<exclusive_writelock_ptr_t> > m_access_lease_obj_shptr;
+		std::array<xscope_aco_splitter_ra_section_t, N> m_splitter_aco_ra_sections;
+		std::array<xscope_ras_ar_t, N> m_ra_section_ars;
+	};
+
 	template <typename _TExclusiveWritelockPtr>
 	class TAsyncRASectionSplitterXWP {
 	public:
@@ -2593,6 +2698,18 @@ namespace mse {
 	TXScopeAsyncRASectionSplitter(_TAccessRequester, size_t)->TXScopeAsyncRASectionSplitter<_TAccessRequester>;
 #endif /* MSE_HAS_CXX17 */
 
+	template <typename _TAccessRequester, size_t N>
+	class TXScopeAsyncNWayRASectionSplitter : public TXScopeAsyncNWayRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer()), N> {
+	public:
+		typedef TXScopeAsyncNWayRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer()), N> base_class;
+
+		TXScopeAsyncNWayRASectionSplitter(_TAccessRequester& ar) : base_class(ar.exclusive_pointer()) {}
+
+	private:
+		TXScopeAsyncNWayRASectionSplitter & operator=(const TXScopeAsyncNWayRASectionSplitter& _Right_cref) = delete;
+		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
+	};
+
 	template <typename _TAccessRequester>
 	class TAsyncRASectionSplitter : public TAsyncRASectionSplitterXWP<decltype(std::declval<_TAccessRequester>().exclusive_pointer())> {
 	public:
@@ -2804,6 +2921,194 @@ namespace mse {
 		std::map<handle_t, movable_xscope_thread> m_xscope_thread_map;
 	};
 
+	namespace impl {
+		/* parallel_thread_pool is a reusable set of worker threads used by parallel_for_each_section() and
+		parallel_transform(). A call to for_each_index() blocks until all the indexes of its batch have been processed. The
+		calling thread participates in the processing of its own batch, so nested calls won't deadlock even when all the
+		workers are busy. */
+		class parallel_thread_pool {
+		public:
+			explicit parallel_thread_pool(size_t num_worker_threads) {
+				m_workers.reserve(num_worker_threads);
+				for (size_t i = 0; i < num_worker_threads; i += 1) {
+					m_workers.emplace_back([this]() { (*this).worker_loop(); });
+				}
+			}
+			~parallel_thread_pool() {
+				{
+					std::unique_lock<std::mutex> lock1(m_mutex);
+					m_stop_requested = true;
+				}
+				m_cv.notify_all();
+				for (auto& worker : m_workers) {
+					worker.join();
+				}
+			}
+
+			/* The number of threads (including the calling thread) that may process a batch concurrently. */
+			size_t concurrency() const { return m_workers.size() + 1; }
+
+			/* Calls function1(i) for each i in [0, count). The first exception thrown by any invocation is rethrown
+			once all the invocations have completed. */
+			template<typename _TFunction>
+			void for_each_index(size_t count, const _TFunction& function1) {
+				if (0 == count) { return; }
+				auto batch_shptr = std::make_shared<batch_t>(std::function<void(size_t)>(std::cref(function1)), count);
+				if (1 < count) {
+					{
+						std::unique_lock<std::mutex> lock1(m_mutex);
+						m_batches.push_back(batch_shptr);
+					}
+					m_cv.notify_all();
+				}
+				s_process_batch(*batch_shptr);
+				{
+					std::unique_lock<std::mutex> lock1(batch_shptr->m_mutex);
+					batch_shptr->m_cv.wait(lock1, [&batch_shptr]() { return batch_shptr->m_count == batch_shptr->m_num_completed; });
+				}
+				if (1 < count) {
+					std::unique_lock<std::mutex> lock1(m_mutex);
+					auto found_it = std::find(m_batches.begin(), m_batches.end(), batch_shptr);
+					if (m_batches.end() != found_it) {
+						m_batches.erase(found_it);
+					}
+				}
+				if (batch_shptr->m_eptr) {
+					std::rethrow_exception(batch_shptr->m_eptr);
+				}
+			}
+
+			static parallel_thread_pool& default_pool() {
+				static parallel_thread_pool s_pool(s_default_num_worker_threads());
+				return s_pool;
+			}
+
+		private:
+			struct batch_t {
+				batch_t(std::function<void(size_t)>&& function1, size_t count) : m_function(std::forward<decltype(function1)>(function1)), m_count(count) {}
+				std::function<void(size_t)> m_function;
+				const size_t m_count;
+				std::atomic<size_t> m_next_index{ 0 };
+				std::mutex m_mutex;
+				std::condition_variable m_cv;
+				size_t m_num_completed = 0;
+				std::exception_ptr m_eptr;
+			};
+
+			static size_t s_default_num_worker_threads() {
+				const size_t hw_concurrency = std::thread::hardware_concurrency();
+				return (1 < hw_concurrency) ? (hw_concurrency - 1) : 0;
+			}
+
+			static void s_process_batch(batch_t& batch) {
+				while (true) {
+					const auto index = batch.m_next_index.fetch_add(1);
+					if (batch.m_count <= index) {
+						break;
+					}
+					std::exception_ptr eptr;
+					try {
+						batch.m_function(index);
+					}
+					catch (...) {
+						eptr = std::current_exception();
+					}
+					std::unique_lock<std::mutex> lock1(batch.m_mutex);
+					if (eptr && (!batch.m_eptr)) {
+						batch.m_eptr = eptr;
+					}
+					batch.m_num_completed += 1;
+					if (batch.m_count == batch.m_num_completed) {
+						batch.m_cv.notify_all();
+					}
+				}
+			}
+
+			void worker_loop() {
+				while (true) {
+					std::shared_ptr<batch_t> batch_shptr;
+					{
+						std::unique_lock<std::mutex> lock1(m_mutex);
+						m_cv.wait(lock1, [this]() { return m_stop_requested || (!m_batches.empty()); });
+						if (m_batches.empty()) {
+							return;
+						}
+						batch_shptr = m_batches.front();
+						if (batch_shptr->m_count <= batch_shptr->m_next_index) {
+							/* All the indexes of this batch have been claimed. */
+							m_batches.pop_front();
+							continue;
+						}
+					}
+					s_process_batch(*batch_shptr);
+				}
+			}
+
+			parallel_thread_pool(const parallel_thread_pool&) = delete;
+			parallel_thread_pool& operator=(const parallel_thread_pool&) = delete;
+
+			std::vector<std::thread> m_workers;
+			std::deque<std::shared_ptr<batch_t> > m_batches;
+			std::mutex m_mutex;
+			std::condition_variable m_cv;
+			bool m_stop_requested = false;
+		};
+
+		template<typename _TExclusiveWritelockPtr, typename _TSectionFunction>
+		void parallel_for_each_section_helper1(_TExclusiveWritelockPtr&& exclusive_writelock_ptr, const _TSectionFunction& section_function, size_t num_sections) {
+			auto& pool = parallel_thread_pool::default_pool();
+			const size_t num_elements = exclusive_writelock_ptr->size();
+			if (0 == num_sections) {
+				num_sections = pool.concurrency();
+			}
+			if (num_elements < num_sections) {
+				num_sections = num_elements;
+			}
+			if (0 == num_sections) {
+				return;
+			}
+			/* Sections sizes differ by at most one. */
+			std::vector<size_t> section_sizes(num_sections, num_elements / num_sections);
+			for (size_t i = 0; i < num_elements % num_sections; i += 1) {
+				section_sizes[i] += 1;
+			}
+
+			/* The splitter holds the exclusive writelock pointer (and so exclusive access to the container) until it is
+			destroyed, which is after all the sections have been processed. */
+			TAsyncRASectionSplitterXWP<_TExclusiveWritelockPtr> ra_section_split1(std::forward<_TExclusiveWritelockPtr>(exclusive_writelock_ptr), section_sizes);
+			pool.for_each_index(num_sections, [&ra_section_split1, &section_function](size_t index) {
+				auto ar = ra_section_split1.ra_section_access_requester(index);
+				/* As with mstd::thread, each (concurrent) invocation gets its own copy of the function object, so the
+				function only needs to be passable, not shareable. */
+				auto section_function_copy = section_function;
+				section_function_copy(ar.writelock_ra_section());
+			});
+		}
+	}
+
+	/* parallel_for_each_section() obtains exclusive access to the random access container of the given access requester,
+	splits it into (by default, as many as there are hardware threads) disjoint sections of (nearly) equal size, and calls
+	the given function on each section (as a writelock random access section) using a (shared) pool of reusable threads.
+	Each section is processed with its own copy of the given function object. It returns once all the sections have been
+	processed. */
+	template<typename _TAccessRequester, typename _TFunction>
+	void parallel_for_each_section(_TAccessRequester& ar, const _TFunction& function1, size_t num_sections = 0) {
+		mstd::thread::s_valid_if_passable(function1);
+		impl::parallel_for_each_section_helper1(ar.exclusive_pointer(), function1, num_sections);
+	}
+
+	/* parallel_transform() replaces each element, x, of the access requester's random access container with
+	function1(x), processing disjoint sections of the container in parallel. */
+	template<typename _TAccessRequester, typename _TFunction>
+	void parallel_transform(_TAccessRequester& ar, const _TFunction& function1, size_t num_sections = 0) {
+		mstd::thread::s_valid_if_passable(function1);
+		impl::parallel_for_each_section_helper1(ar.exclusive_pointer(), [function1_copy = function1](auto ra_section) mutable {
+			for (size_t i = 0; i < ra_section.size(); i += 1) {
+				ra_section[i] = function1_copy(ra_section[i]);
+			}
+		}, num_sections);
+	}
+
 	template<class _Ty> class xscope_future;
 	template<class _Fty, class... _ArgTypes> auto xscope_async(std::launch _Policy, _Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(_Policy, std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
 	template<class _Fty, class... _ArgTypes> auto xscope_async(_Fty&& _Fnarg, _ArgTypes&&... _Args) -> xscope_future<decltype(std::async(std::forward<_Fty>(_Fnarg), std::forward<_ArgTypes>(_Args)...).get())>;
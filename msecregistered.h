@@ -18,6 +18,7 @@ objects of a given type. */
 
 #include "msepointerbasics.h"
 #include "mseprimitives.h"
+#include "msescope.h"
 #include <utility>
 #include <unordered_map>
 #include <mutex>
@@ -224,6 +225,130 @@ namespace mse {
 				mutable const CCRegisteredNode* m_ptr = nullptr;
 			};
 
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			/* With MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION defined, cregistered pointers aren't tracked by their
+			targets. Instead, each cregistered object is associated with a "generation cell" whose generation number is
+			incremented when the object is destroyed. Pointers record the generation of their target's cell and check that it
+			hasn't changed when they are dereferenced. So destroying a target is O(1) regardless of the number of pointers
+			targeting it, at the cost of a slightly more expensive dereference. Generation cells are never deallocated (they
+			are recycled), so it is always safe for a pointer to inspect the cell of its (possibly destroyed) target. */
+			class CCRegisteredGenerationCell {
+			public:
+				typedef unsigned long long generation_t;
+				generation_t generation() const { return m_generation; }
+				void add_pin() { m_pin_count += 1; }
+				void remove_pin() { assert(1 <= m_pin_count); m_pin_count -= 1; }
+				bool is_pinned() const { return (0 != m_pin_count); }
+
+			private:
+				generation_t m_generation = 1;
+				size_t m_pin_count = 0;
+				CCRegisteredGenerationCell* m_next_free_ptr = nullptr;
+
+				friend class CCRegisteredGenerationCellPool;
+			};
+
+			/* A thread_local free list of generation cells. */
+			class CCRegisteredGenerationCellPool {
+			public:
+				static CCRegisteredGenerationCell* acquire() {
+					auto& free_head_ref = tl_free_head_ref();
+					if (!free_head_ref) {
+						refill();
+					}
+					auto retval = free_head_ref;
+					free_head_ref = retval->m_next_free_ptr;
+					retval->m_next_free_ptr = nullptr;
+					return retval;
+				}
+				static void release(CCRegisteredGenerationCell* cell_ptr) {
+					cell_ptr->m_generation += 1;
+					auto& free_head_ref = tl_free_head_ref();
+					cell_ptr->m_next_free_ptr = free_head_ref;
+					free_head_ref = cell_ptr;
+				}
+
+			private:
+				/* When a thread exits, its free cells are transferred to a global free list for reuse by other threads. */
+				class CThreadExitHandler {
+				public:
+					~CThreadExitHandler() {
+						auto& free_head_ref = tl_free_head_ref();
+						if (free_head_ref) {
+							auto tail_ptr = free_head_ref;
+							while (tail_ptr->m_next_free_ptr) {
+								tail_ptr = tail_ptr->m_next_free_ptr;
+							}
+							std::lock_guard<std::mutex> lock(global_mutex_ref());
+							tail_ptr->m_next_free_ptr = global_free_head_ref();
+							global_free_head_ref() = free_head_ref;
+							free_head_ref = nullptr;
+						}
+					}
+				};
+
+				static void refill() {
+					thread_local CThreadExitHandler tl_thread_exit_handler;
+					auto& free_head_ref = tl_free_head_ref();
+					{
+						std::lock_guard<std::mutex> lock(global_mutex_ref());
+						if (global_free_head_ref()) {
+							/* Take up to sc_cells_per_chunk cells from the global free list. */
+							auto head_ptr = global_free_head_ref();
+							auto tail_ptr = head_ptr;
+							for (size_t i = 1; (sc_cells_per_chunk > i) && (tail_ptr->m_next_free_ptr); i += 1) {
+								tail_ptr = tail_ptr->m_next_free_ptr;
+							}
+							global_free_head_ref() = tail_ptr->m_next_free_ptr;
+							tail_ptr->m_next_free_ptr = free_head_ref;
+							free_head_ref = head_ptr;
+							return;
+						}
+					}
+					/* Cell memory is intentionally never deallocated. */
+					auto chunk = new CCRegisteredGenerationCell[sc_cells_per_chunk];
+					for (size_t i = 0; sc_cells_per_chunk > i; i += 1) {
+						chunk[i].m_next_free_ptr = free_head_ref;
+						free_head_ref = &(chunk[i]);
+					}
+				}
+
+				static CCRegisteredGenerationCell*& tl_free_head_ref() {
+					thread_local CCRegisteredGenerationCell* tl_free_head_ptr = nullptr;
+					return tl_free_head_ptr;
+				}
+				static CCRegisteredGenerationCell*& global_free_head_ref() {
+					static CCRegisteredGenerationCell* s_free_head_ptr = nullptr;
+					return s_free_head_ptr;
+				}
+				static std::mutex& global_mutex_ref() {
+					static std::mutex s_mutex;
+					return s_mutex;
+				}
+
+				static const size_t sc_cells_per_chunk = 256/*arbitrary*/;
+			};
+
+			class CCRegisteredNode {
+			public:
+				virtual void rn_set_pointer_to_null() const = 0;
+				void set_target_cell(const CCRegisteredGenerationCell* cell_ptr) const {
+					m_cell_ptr = cell_ptr;
+					m_generation = cell_ptr->generation();
+				}
+				void copy_target_cell(const CCRegisteredNode& src_cref) const {
+					m_cell_ptr = src_cref.m_cell_ptr;
+					m_generation = src_cref.m_generation;
+				}
+				bool target_is_alive() const {
+					return (m_cell_ptr) && (m_cell_ptr->generation() == m_generation);
+				}
+
+			private:
+				mutable const CCRegisteredGenerationCell* m_cell_ptr = nullptr;
+				mutable CCRegisteredGenerationCell::generation_t m_generation = 0;
+			};
+#else // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
 			/* node of a (doubly-linked) list of pointers */
 			class CCRegisteredNode {
 			public:
@@ -248,6 +373,23 @@ namespace mse {
 				mutable mse::us::impl::CCRNMutablePointer m_next_ptr = nullptr;
 				mutable const mse::us::impl::CCRNMutablePointer* m_prev_next_ptr_ptr = nullptr;
 			};
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+
+			/* Called if a cregistered object is destroyed while "pinned" (by a TXScopeCRegisteredPin<>). */
+			inline void cregistered_pinned_target_destroyed_fatal_error() {
+				/* It would be unsafe to allow this object to be destroyed as there are outstanding scope pointers to this object. */
+#ifdef MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER
+				MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER("Fatal Error: mse::TNDCRegisteredObj<> destructed while pinned \n");
+#endif // MSE_CUSTOM_FATAL_ERROR_MESSAGE_HANDLER
+				assert(false); std::terminate();
+			}
+
+			/* A pin node is registered with its target like a cregistered pointer, but rather than being set to null when
+			the target is destroyed, it raises a fatal error. */
+			class CCRegisteredPinNode : public CCRegisteredNode {
+			public:
+				void rn_set_pointer_to_null() const override { cregistered_pinned_target_destroyed_fatal_error(); }
+			};
 		}
 	}
 
@@ -259,28 +401,28 @@ namespace mse {
 		TNDCRegisteredPointer() : mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>() {}
 		TNDCRegisteredPointer(const TNDCRegisteredPointer& src_cref) : mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
 		TNDCRegisteredPointer(const TNDCRegisteredPointer<_Ty2>& src_cref) : mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		TNDCRegisteredPointer(std::nullptr_t) : mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>(nullptr) {}
 		virtual ~TNDCRegisteredPointer() {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).unregister_pointer(*this);
+				TNDCRegisteredObj<_Ty>::unregister_pointer(*this);
 			}
 		}
 		TNDCRegisteredPointer<_Ty>& operator=(const TNDCRegisteredPointer<_Ty>& _Right_cref) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).unregister_pointer(*this);
+				TNDCRegisteredObj<_Ty>::unregister_pointer(*this);
 			}
 			mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>::operator=(_Right_cref);
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(_Right_cref);
 			}
 			return (*this);
 		}
@@ -288,9 +430,21 @@ namespace mse {
 		TNDCRegisteredPointer<_Ty>& operator=(const TNDCRegisteredPointer<_Ty2>& _Right_cref) {
 			return (*this).operator=(TNDCRegisteredPointer(_Right_cref));
 		}
-		operator bool() const { return !(!((*this).m_ptr)); }
+		TNDCRegisteredObj<_Ty>& operator*() const {
+			(*this).invalidate_if_target_destroyed();
+			return mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>::operator*();
+		}
+		TNDCRegisteredObj<_Ty>* operator->() const {
+			(*this).invalidate_if_target_destroyed();
+			return mse::us::TSaferPtr<TNDCRegisteredObj<_Ty>>::operator->();
+		}
+		operator bool() const {
+			(*this).invalidate_if_target_destroyed();
+			return !(!((*this).m_ptr));
+		}
 		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
 		MSE_DEPRECATED explicit operator _Ty*() const {
+			(*this).invalidate_if_target_destroyed();
 #ifdef NATIVE_PTR_DEBUG_HELPER1
 			if (nullptr == (*this).m_ptr) {
 				int q = 5; /* just a line of code for putting a debugger break point */
@@ -305,6 +459,7 @@ namespace mse {
 		void cregistered_delete() const {
 			auto a = asANativePointerToTNDCRegisteredObj();
 			delete a;
+			(*this).invalidate_if_target_destroyed();
 			assert(nullptr == (*this).m_ptr);
 		}
 
@@ -320,6 +475,7 @@ namespace mse {
 
 		/* This function, if possible, should not be used. It is meant to be used exclusively by cregistered_delete<>(). */
 		TNDCRegisteredObj<_Ty>* asANativePointerToTNDCRegisteredObj() const {
+			(*this).invalidate_if_target_destroyed();
 #ifdef NATIVE_PTR_DEBUG_HELPER1
 			if (nullptr == (*this).m_ptr) {
 				int q = 5; /* just a line of code for putting a debugger break point */
@@ -328,6 +484,25 @@ namespace mse {
 			return static_cast<TNDCRegisteredObj<_Ty>*>((*this).m_ptr);
 		}
 
+		template<class TSrc>
+		void register_as_copy_of(const TSrc& src_cref) {
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			/* The source pointer's target may have been destroyed, so we get the target's generation cell from the source
+			pointer rather than from the target. */
+			(*this).copy_target_cell(src_cref);
+#else // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			(void)src_cref;
+			(*((*this).m_ptr)).register_pointer(*this);
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+		}
+		void invalidate_if_target_destroyed() const {
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			if ((nullptr != (*this).m_ptr) && (!(*this).target_is_alive())) {
+				(*this).m_ptr = nullptr;
+			}
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+		}
+
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		template <class Y> friend class TNDCRegisteredPointer;
@@ -341,39 +516,39 @@ namespace mse {
 		TNDCRegisteredConstPointer() : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>() {}
 		TNDCRegisteredConstPointer(const TNDCRegisteredConstPointer& src_cref) : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
 		TNDCRegisteredConstPointer(const TNDCRegisteredConstPointer<_Ty2>& src_cref) : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		TNDCRegisteredConstPointer(const TNDCRegisteredPointer<_Ty>& src_cref) : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		template<class _Ty2, class = typename std::enable_if<std::is_convertible<_Ty2 *, _Ty *>::value, void>::type>
 		TNDCRegisteredConstPointer(const TNDCRegisteredPointer<_Ty2>& src_cref) : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>(src_cref.m_ptr) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(src_cref);
 			}
 		}
 		TNDCRegisteredConstPointer(std::nullptr_t) : mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>(nullptr) {}
 		virtual ~TNDCRegisteredConstPointer() {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).unregister_pointer(*this);
+				TNDCRegisteredObj<_Ty>::unregister_pointer(*this);
 			}
 		}
 		TNDCRegisteredConstPointer<_Ty>& operator=(const TNDCRegisteredConstPointer<_Ty>& _Right_cref) {
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).unregister_pointer(*this);
+				TNDCRegisteredObj<_Ty>::unregister_pointer(*this);
 			}
 			mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>::operator=(_Right_cref);
 			if (nullptr != (*this).m_ptr) {
-				(*((*this).m_ptr)).register_pointer(*this);
+				(*this).register_as_copy_of(_Right_cref);
 			}
 			return (*this);
 		}
@@ -382,9 +557,21 @@ namespace mse {
 			return (*this).operator=(TNDCRegisteredConstPointer(_Right_cref));
 		}
 
-		operator bool() const { return !(!((*this).m_ptr)); }
+		const TNDCRegisteredObj<_Ty>& operator*() const {
+			(*this).invalidate_if_target_destroyed();
+			return mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>::operator*();
+		}
+		const TNDCRegisteredObj<_Ty>* operator->() const {
+			(*this).invalidate_if_target_destroyed();
+			return mse::us::TSaferPtr<const TNDCRegisteredObj<_Ty>>::operator->();
+		}
+		operator bool() const {
+			(*this).invalidate_if_target_destroyed();
+			return !(!((*this).m_ptr));
+		}
 		/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
 		MSE_DEPRECATED explicit operator const _Ty*() const {
+			(*this).invalidate_if_target_destroyed();
 #ifdef NATIVE_PTR_DEBUG_HELPER1
 			if (nullptr == (*this).m_ptr) {
 				int q = 5; /* just a line of code for putting a debugger break point */
@@ -399,6 +586,7 @@ namespace mse {
 		void cregistered_delete() const {
 			auto a = asANativePointerToTNDCRegisteredObj();
 			delete a;
+			(*this).invalidate_if_target_destroyed();
 			assert(nullptr == (*this).m_ptr);
 		}
 
@@ -414,6 +602,7 @@ namespace mse {
 
 		/* This function, if possible, should not be used. It is meant to be used exclusively by cregistered_delete<>(). */
 		const TNDCRegisteredObj<_Ty>* asANativePointerToTNDCRegisteredObj() const {
+			(*this).invalidate_if_target_destroyed();
 #ifdef NATIVE_PTR_DEBUG_HELPER1
 			if (nullptr == (*this).m_ptr) {
 				int q = 5; /* just a line of code for putting a debugger break point */
@@ -422,6 +611,25 @@ namespace mse {
 			return static_cast<const TNDCRegisteredObj<_Ty>*>((*this).m_ptr);
 		}
 
+		template<class TSrc>
+		void register_as_copy_of(const TSrc& src_cref) {
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			/* The source pointer's target may have been destroyed, so we get the target's generation cell from the source
+			pointer rather than from the target. */
+			(*this).copy_target_cell(src_cref);
+#else // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			(void)src_cref;
+			(*((*this).m_ptr)).register_pointer(*this);
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+		}
+		void invalidate_if_target_destroyed() const {
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+			if ((nullptr != (*this).m_ptr) && (!(*this).target_is_alive())) {
+				(*this).m_ptr = nullptr;
+			}
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+		}
+
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		template <class Y> friend class TNDCRegisteredConstPointer;
@@ -623,6 +831,30 @@ namespace mse {
 		TNDCRegisteredFixedConstPointer<_TROFLy> mse_cregistered_fptr() const { return TNDCRegisteredFixedConstPointer<_TROFLy>(this); }
 
 		/* todo: make these private */
+#ifdef MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
+		void register_pointer(const mse::us::impl::CCRegisteredNode& node_cref) const {
+			node_cref.set_target_cell(m_cell_ptr);
+		}
+		static void unregister_pointer(const mse::us::impl::CCRegisteredNode& /*node_cref*/) {}
+		void register_pin(const mse::us::impl::CCRegisteredPinNode& /*node_cref*/) const {
+			m_cell_ptr->add_pin();
+		}
+		void unregister_pin(const mse::us::impl::CCRegisteredPinNode& /*node_cref*/) const {
+			m_cell_ptr->remove_pin();
+		}
+
+	private:
+		void unregister_and_set_outstanding_pointers_to_null() const {
+			if (m_cell_ptr->is_pinned()) {
+				mse::us::impl::cregistered_pinned_target_destroyed_fatal_error();
+			}
+			/* Outstanding pointers will notice the generation change when they're (next) dereferenced. */
+			mse::us::impl::CCRegisteredGenerationCellPool::release(m_cell_ptr);
+		}
+
+		mse::us::impl::CCRegisteredGenerationCell* m_cell_ptr = mse::us::impl::CCRegisteredGenerationCellPool::acquire();
+	};
+#else // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
 		void register_pointer(const mse::us::impl::CCRegisteredNode& node_cref) const {
 			if (m_head_ptr) {
 				m_head_ptr->set_prev_next_ptr_ptr(node_cref.get_address_of_my_next_ptr());
@@ -640,6 +872,12 @@ namespace mse {
 			node_cref.set_prev_next_ptr_ptr(nullptr);
 			node_cref.set_next_ptr(nullptr);
 		}
+		void register_pin(const mse::us::impl::CCRegisteredPinNode& node_cref) const {
+			register_pointer(node_cref);
+		}
+		void unregister_pin(const mse::us::impl::CCRegisteredPinNode& node_cref) const {
+			unregister_pointer(node_cref);
+		}
 
 	private:
 		void unregister_and_set_outstanding_pointers_to_null() const {
@@ -656,6 +894,7 @@ namespace mse {
 		/* first node in a (doubly-linked) list of pointers targeting this object */
 		mutable mse::us::impl::CCRNMutablePointer m_head_ptr = nullptr;
 	};
+#endif // MSE_CREGISTEREDPOINTER_USE_GENERATION_INVALIDATION
 
 	/* See ndregistered_new(). */
 	template <class _Ty, class... Args>
@@ -689,6 +928,159 @@ namespace mse {
 		}
 	}
 
+
+	/* TXScopeCRegisteredPin<> "pins" the target of a cregistered pointer for the duration of its (scope) lifetime, and lets
+	you obtain a corresponding scope pointer. It's analogous to TXScopeStrongPointerStore<>, except that rather than keeping
+	its target alive, destroying the target while it's pinned results in a fatal error (as with norad pointers). So the
+	(unchecked) scope pointer can be used in place of the (checked) cregistered pointer in performance-critical code, like
+	tight loops. */
+	template<typename _Ty>
+	class TXScopeCRegisteredPin : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef TXScopeCRegisteredPin _Myt;
+		typedef _Ty target_t;
+
+		TXScopeCRegisteredPin(const TXScopeCRegisteredPin&) = delete;
+		TXScopeCRegisteredPin(TXScopeCRegisteredPin&& src) : m_obj_ptr(src.m_obj_ptr), m_target_ptr(src.m_target_ptr) { register_pin(); }
+
+		TXScopeCRegisteredPin(const TNDCRegisteredPointer<_Ty>& src_ptr) : m_obj_ptr(std::addressof(*src_ptr)), m_target_ptr(m_obj_ptr) {
+			register_pin();
+		}
+#ifdef MSE_REGISTEREDPOINTER_DISABLED
+		TXScopeCRegisteredPin(_Ty* src_ptr) : m_target_ptr(src_ptr) {
+			*src_ptr; /* Just verifying that src_ptr points to a target. */
+		}
+#endif // MSE_REGISTEREDPOINTER_DISABLED
+		~TXScopeCRegisteredPin() {
+			if (m_obj_ptr) {
+				m_obj_ptr->unregister_pin(m_node);
+			}
+		}
+
+		auto xscope_ptr() const & {
+			return mse::us::unsafe_make_xscope_pointer_to(*m_target_ptr);
+		}
+		void xscope_ptr() const && = delete;
+
+		operator mse::TXScopeFixedPointer<target_t>() const & {
+			return xscope_ptr();
+		}
+		/* These dereference operators don't need to check for a null or destroyed target. */
+		_Ty& operator*() const {
+			return *m_target_ptr;
+		}
+		_Ty* operator->() const {
+			return m_target_ptr;
+		}
+		bool operator==(const _Myt& rhs) const {
+			return (rhs.m_target_ptr == m_target_ptr);
+		}
+
+		void async_not_shareable_and_not_passable_tag() const {}
+
+	private:
+		void register_pin() {
+			if (m_obj_ptr) {
+				m_obj_ptr->register_pin(m_node);
+			}
+		}
+
+		/* m_obj_ptr is null if registered pointers are disabled. */
+		TNDCRegisteredObj<_Ty>* m_obj_ptr = nullptr;
+		_Ty* m_target_ptr = nullptr;
+		mse::us::impl::CCRegisteredPinNode m_node;
+	};
+
+	template<typename _Ty>
+	class TXScopeCRegisteredConstPin : public mse::us::impl::XScopeTagBase {
+	public:
+		typedef TXScopeCRegisteredConstPin _Myt;
+		typedef _Ty target_t;
+
+		TXScopeCRegisteredConstPin(const TXScopeCRegisteredConstPin&) = delete;
+		TXScopeCRegisteredConstPin(TXScopeCRegisteredConstPin&& src) : m_obj_ptr(src.m_obj_ptr), m_target_ptr(src.m_target_ptr) { register_pin(); }
+
+		TXScopeCRegisteredConstPin(const TNDCRegisteredConstPointer<_Ty>& src_ptr) : m_obj_ptr(std::addressof(*src_ptr)), m_target_ptr(m_obj_ptr) {
+			register_pin();
+		}
+		TXScopeCRegisteredConstPin(const TNDCRegisteredPointer<_Ty>& src_ptr) : m_obj_ptr(std::addressof(*src_ptr)), m_target_ptr(m_obj_ptr) {
+			register_pin();
+		}
+#ifdef MSE_REGISTEREDPOINTER_DISABLED
+		TXScopeCRegisteredConstPin(const _Ty* src_ptr) : m_target_ptr(src_ptr) {
+			*src_ptr; /* Just verifying that src_ptr points to a target. */
+		}
+#endif // MSE_REGISTEREDPOINTER_DISABLED
+		~TXScopeCRegisteredConstPin() {
+			if (m_obj_ptr) {
+				m_obj_ptr->unregister_pin(m_node);
+			}
+		}
+
+		auto xscope_ptr() const & {
+			return mse::us::unsafe_make_xscope_const_pointer_to(*m_target_ptr);
+		}
+		void xscope_ptr() const && = delete;
+
+		operator mse::TXScopeFixedConstPointer<target_t>() const & {
+			return xscope_ptr();
+		}
+		/* These dereference operators don't need to check for a null or destroyed target. */
+		const _Ty& operator*() const {
+			return *m_target_ptr;
+		}
+		const _Ty* operator->() const {
+			return m_target_ptr;
+		}
+		bool operator==(const _Myt& rhs) const {
+			return (rhs.m_target_ptr == m_target_ptr);
+		}
+
+		void async_not_shareable_and_not_passable_tag() const {}
+
+	private:
+		void register_pin() {
+			if (m_obj_ptr) {
+				m_obj_ptr->register_pin(m_node);
+			}
+		}
+
+		/* m_obj_ptr is null if registered pointers are disabled. */
+		const TNDCRegisteredObj<_Ty>* m_obj_ptr = nullptr;
+		const _Ty* m_target_ptr = nullptr;
+		mse::us::impl::CCRegisteredPinNode m_node;
+	};
+
+	template<typename _Ty>
+	auto make_xscope_cregistered_pin(const TNDCRegisteredPointer<_Ty>& src_ptr) {
+		return TXScopeCRegisteredPin<_Ty>(src_ptr);
+	}
+	template<typename _Ty>
+	auto make_xscope_cregistered_pin(const TNDCRegisteredConstPointer<_Ty>& src_ptr) {
+		return TXScopeCRegisteredConstPin<_Ty>(src_ptr);
+	}
+	template<typename _Ty>
+	auto make_xscope_cregistered_const_pin(const TNDCRegisteredPointer<_Ty>& src_ptr) {
+		return TXScopeCRegisteredConstPin<_Ty>(src_ptr);
+	}
+	template<typename _Ty>
+	auto make_xscope_cregistered_const_pin(const TNDCRegisteredConstPointer<_Ty>& src_ptr) {
+		return TXScopeCRegisteredConstPin<_Ty>(src_ptr);
+	}
+#ifdef MSE_REGISTEREDPOINTER_DISABLED
+	template<typename _Ty>
+	auto make_xscope_cregistered_pin(_Ty* src_ptr) {
+		return TXScopeCRegisteredPin<_Ty>(src_ptr);
+	}
+	template<typename _Ty>
+	auto make_xscope_cregistered_pin(const _Ty* src_ptr) {
+		return TXScopeCRegisteredConstPin<_Ty>(src_ptr);
+	}
+	template<typename _Ty>
+	auto make_xscope_cregistered_const_pin(const _Ty* src_ptr) {
+		return TXScopeCRegisteredConstPin<_Ty>(src_ptr);
+	}
+#endif // MSE_REGISTEREDPOINTER_DISABLED
 }
 
 namespace std {
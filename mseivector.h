@@ -9,6 +9,7 @@
 #define MSEIVECTOR_H
 
 #include "msemsevector.h"
+#include "mserefcounting.h"
 
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
 #pragma push_macro("MSE_THROW")
@@ -52,67 +53,71 @@ namespace mse {
 		typedef typename _MV::reference reference;
 		typedef typename _MV::const_reference const_reference;
 
-		const _MV& msevector() const { return (*m_shptr); }
-		_MV& msevector() { return (*m_shptr); }
+		const _MV& msevector() const { return (*m_refcptr); }
+		_MV& msevector() { return (*m_refcptr); }
 		operator const _MV() const { return msevector(); }
 		operator _MV() { return msevector(); }
 
-		explicit ivector(const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_Al)) {}
-		explicit ivector(size_type _N) : m_shptr(std::make_shared<_MV>(_N)) {}
-		explicit ivector(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_N, _V, _Al)) {}
-		ivector(_MV&& _X) : m_shptr(std::make_shared<_MV>(std::forward<decltype(_X)>(_X))) {}
-		ivector(const _MV& _X) : m_shptr(std::make_shared<_MV>(_X)) {}
-		ivector(_Myt&& _X) : m_shptr(std::make_shared<_MV>(std::forward<decltype(_X)>(_X).msevector())) {}
-		ivector(const _Myt& _X) : m_shptr(std::make_shared<_MV>(_X.msevector())) {}
+		explicit ivector(const _A& _Al = _A()) : m_refcptr(mse::make_refcounting<_MV>(_Al)) {}
+		explicit ivector(size_type _N) : m_refcptr(mse::make_refcounting<_MV>(_N)) {}
+		explicit ivector(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_refcptr(mse::make_refcounting<_MV>(_N, _V, _Al)) {}
+		ivector(_MV&& _X) : m_refcptr(mse::make_refcounting<_MV>(std::forward<decltype(_X)>(_X))) {}
+		ivector(const _MV& _X) : m_refcptr(mse::make_refcounting<_MV>(_X)) {}
+		ivector(_Myt&& _X) : m_refcptr(mse::make_refcounting<_MV>(std::forward<decltype(_X)>(_X).msevector())) {}
+		ivector(const _Myt& _X) : m_refcptr(mse::make_refcounting<_MV>(_X.msevector())) {}
 		typedef typename _MV::const_iterator _It;
-		ivector(_It _F, _It _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_F, _L, _Al)) {}
-		ivector(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_F, _L, _Al)) {}
+		ivector(_It _F, _It _L, const _A& _Al = _A()) : m_refcptr(mse::make_refcounting<_MV>(_F, _L, _Al)) {}
+		ivector(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_refcptr(mse::make_refcounting<_MV>(_F, _L, _Al)) {}
 		template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			ivector(_Iter _First, _Iter _Last) : m_shptr(std::make_shared<_MV>(_First, _Last)) {}
+			ivector(_Iter _First, _Iter _Last) : m_refcptr(mse::make_refcounting<_MV>(_First, _Last)) {}
 		template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			ivector(_Iter _First, _Iter _Last, const _A& _Al) : m_shptr(std::make_shared<_MV>(_First, _Last, _Al)) {}
-
-		_Myt& operator=(_MV&& _X) { m_shptr->operator=(std::forward<decltype(_X)>(_X)); return (*this); }
-		_Myt& operator=(const _MV& _X) { m_shptr->operator=(_X); return (*this); }
-		_Myt& operator=(_Myt&& _X) { m_shptr->operator=(std::forward<decltype(_X)>(_X).msevector()); return (*this); }
-		_Myt& operator=(const _Myt& _X) { m_shptr->operator=(_X.msevector()); return (*this); }
-		void reserve(size_type _Count) { m_shptr->reserve(_Count); }
-		void resize(size_type _N, const _Ty& _X = _Ty()) { m_shptr->resize(_N, _X); }
-		typename _MV::const_reference operator[](size_type _P) const { return m_shptr->operator[](_P); }
-		typename _MV::reference operator[](size_type _P) { return m_shptr->operator[](_P); }
-		void push_back(_Ty&& _X) { m_shptr->push_back(std::forward<decltype(_X)>(_X)); }
-		void push_back(const _Ty& _X) { m_shptr->push_back(_X); }
-		void pop_back() { m_shptr->pop_back(); }
-		void assign(_It _F, _It _L) { m_shptr->assign(_F, _L); }
-		void assign(size_type _N, const _Ty& _X = _Ty()) { m_shptr->assign(_N, _X); }
+			ivector(_Iter _First, _Iter _Last, const _A& _Al) : m_refcptr(mse::make_refcounting<_MV>(_First, _Last, _Al)) {}
+
+		_Myt& operator=(_MV&& _X) { m_refcptr->operator=(std::forward<decltype(_X)>(_X)); return (*this); }
+		_Myt& operator=(const _MV& _X) { m_refcptr->operator=(_X); return (*this); }
+		_Myt& operator=(_Myt&& _X) { m_refcptr->operator=(std::forward<decltype(_X)>(_X).msevector()); return (*this); }
+		_Myt& operator=(const _Myt& _X) { m_refcptr->operator=(_X.msevector()); return (*this); }
+		void reserve(size_type _Count) { m_refcptr->reserve(_Count); }
+		void resize(size_type _N, const _Ty& _X = _Ty()) { m_refcptr->resize(_N, _X); }
+		typename _MV::const_reference operator[](size_type _P) const { return m_refcptr->operator[](_P); }
+		typename _MV::reference operator[](size_type _P) { return m_refcptr->operator[](_P); }
+		void push_back(_Ty&& _X) { m_refcptr->push_back(std::forward<decltype(_X)>(_X)); }
+		void push_back(const _Ty& _X) { m_refcptr->push_back(_X); }
+		void pop_back() { m_refcptr->pop_back(); }
+		void assign(_It _F, _It _L) { m_refcptr->assign(_F, _L); }
+		void assign(size_type _N, const _Ty& _X = _Ty()) { m_refcptr->assign(_N, _X); }
 		template<class ..._Valty>
-		void emplace_back(_Valty&& ..._Val) { m_shptr->emplace_back(std::forward<_Valty>(_Val)...); }
-		void clear() { m_shptr->clear(); }
-		void swap(_MV& _X) { m_shptr->swap(_X); }
-		void swap(_Myt& _X) { m_shptr->swap(_X.msevector()); }
-		void swap(mse::nii_vector<_Ty, _A>& _X) { m_shptr->swap(_X); }
-		void swap(std::vector<_Ty, _A>& _X) { m_shptr->swap(_X); }
-
-		ivector(_XSTD initializer_list<typename _MV::value_type> _Ilist, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_Ilist, _Al)) {}
-		_Myt& operator=(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_shptr->operator=(_Ilist); return (*this); }
-		void assign(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_shptr->assign(_Ilist); }
-
-		size_type capacity() const _NOEXCEPT{ return m_shptr->capacity(); }
-		void shrink_to_fit() { m_shptr->shrink_to_fit(); }
-		size_type size() const _NOEXCEPT{ return m_shptr->size(); }
-		size_type max_size() const _NOEXCEPT{ return m_shptr->max_size(); }
-		bool empty() const _NOEXCEPT{ return m_shptr->empty(); }
-		_A get_allocator() const _NOEXCEPT{ return m_shptr->get_allocator(); }
-		typename _MV::const_reference at(size_type _Pos) const { return m_shptr->at(_Pos); }
-		typename _MV::reference at(size_type _Pos) { return m_shptr->at(_Pos); }
-		typename _MV::reference front() { return m_shptr->front(); }
-		typename _MV::const_reference front() const { return m_shptr->front(); }
-		typename _MV::reference back() { return m_shptr->back(); }
-		typename _MV::const_reference back() const { return m_shptr->back(); }
+		void emplace_back(_Valty&& ..._Val) { m_refcptr->emplace_back(std::forward<_Valty>(_Val)...); }
+		void clear() { m_refcptr->clear(); }
+		void swap(_MV& _X) { m_refcptr->swap(_X); }
+		void swap(_Myt& _X) { m_refcptr->swap(_X.msevector()); }
+		void swap(mse::nii_vector<_Ty, _A>& _X) { m_refcptr->swap(_X); }
+		void swap(std::vector<_Ty, _A>& _X) { m_refcptr->swap(_X); }
+
+		ivector(_XSTD initializer_list<typename _MV::value_type> _Ilist, const _A& _Al = _A()) : m_refcptr(mse::make_refcounting<_MV>(_Ilist, _Al)) {}
+		_Myt& operator=(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_refcptr->operator=(_Ilist); return (*this); }
+		void assign(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_refcptr->assign(_Ilist); }
+
+		size_type capacity() const _NOEXCEPT{ return m_refcptr->capacity(); }
+		void shrink_to_fit() { m_refcptr->shrink_to_fit(); }
+		size_type size() const _NOEXCEPT{ return m_refcptr->size(); }
+		size_type max_size() const _NOEXCEPT{ return m_refcptr->max_size(); }
+		bool empty() const _NOEXCEPT{ return m_refcptr->empty(); }
+		_A get_allocator() const _NOEXCEPT{ return m_refcptr->get_allocator(); }
+		typename _MV::const_reference at(size_type _Pos) const { return m_refcptr->at(_Pos); }
+		typename _MV::reference at(size_type _Pos) { return m_refcptr->at(_Pos); }
+		typename _MV::reference front() { return m_refcptr->front(); }
+		typename _MV::const_reference front() const { return m_refcptr->front(); }
+		typename _MV::reference back() { return m_refcptr->back(); }
+		typename _MV::const_reference back() const { return m_refcptr->back(); }
 
 		class xscope_cipointer;
 		class xscope_ipointer;
 
+		/* cipointer and ipointer hold their iterator state themselves and are tracked by the vector "intrusively" (via a linked
+		list threaded through the iterators themselves), so their construction and destruction doesn't allocate, and using
+		them doesn't involve any indirection through the vector. They hold a (non-thread-safe) reference counting pointer to
+		the (underlying) vector, so they remain safe even if they outlive the ivector. */
 		class cipointer : public _MV::random_access_const_iterator_base, public mse::us::impl::AsyncNotShareableAndNotPassableTagBase {
 		public:
 			typedef typename _MV::mm_const_iterator_type::iterator_category iterator_category;
@@ -122,60 +127,59 @@ namespace mse {
 			typedef typename _MV::mm_const_iterator_type::pointer pointer;
 			typedef typename _MV::mm_const_iterator_type::reference reference;
 
-			cipointer(const _Myt& owner_cref) : m_msevector_cshptr(owner_cref.m_shptr), m_cipointer(*(owner_cref.m_shptr)) {}
-			cipointer(const cipointer& src_cref) : m_msevector_cshptr(src_cref.m_msevector_cshptr), m_cipointer(src_cref.m_cipointer) {}
+			cipointer(const _Myt& owner_cref) : m_msevector_crefcptr(owner_cref.m_refcptr), m_node(*(owner_cref.m_refcptr)) {}
+			cipointer(const cipointer& src_cref) : m_msevector_crefcptr(src_cref.m_msevector_crefcptr), m_node(src_cref.m_node) {}
 			~cipointer() {}
-			const typename _MV::cipointer& msevector_cipointer() const { return m_cipointer; }
-			typename _MV::cipointer& msevector_cipointer() { return m_cipointer; }
-			const typename _MV::cipointer& mvcip() const { return msevector_cipointer(); }
-			typename _MV::cipointer& mvcip() { return msevector_cipointer(); }
+			typename _MV::mm_const_iterator_type& const_item_pointer() const { return m_node.mm_iterator(); }
+			typename _MV::mm_const_iterator_type& cip() const { return const_item_pointer(); }
 
-			void reset() { msevector_cipointer().reset(); }
-			bool points_to_an_item() const { return msevector_cipointer().points_to_an_item(); }
-			bool points_to_end_marker() const { return msevector_cipointer().points_to_end_marker(); }
-			bool points_to_beginning() const { return msevector_cipointer().points_to_beginning(); }
+			void reset() { const_item_pointer().reset(); }
+			bool points_to_an_item() const { return const_item_pointer().points_to_an_item(); }
+			bool points_to_end_marker() const { return const_item_pointer().points_to_end_marker(); }
+			bool points_to_beginning() const { return const_item_pointer().points_to_beginning(); }
 			/* has_next_item_or_end_marker() is just an alias for points_to_an_item(). */
-			bool has_next_item_or_end_marker() const { return msevector_cipointer().has_next_item_or_end_marker(); }
+			bool has_next_item_or_end_marker() const { return const_item_pointer().has_next_item_or_end_marker(); }
 			/* has_next() is just an alias for points_to_an_item() that's familiar to java programmers. */
-			bool has_next() const { return msevector_cipointer().has_next(); }
-			bool has_previous() const { return msevector_cipointer().has_previous(); }
-			void set_to_beginning() { msevector_cipointer().set_to_beginning(); }
-			void set_to_end_marker() { msevector_cipointer().set_to_end_marker(); }
-			void set_to_next() { msevector_cipointer().set_to_next(); }
-			void set_to_previous() { msevector_cipointer().set_to_previous(); }
-			cipointer& operator ++() { msevector_cipointer().operator ++(); return (*this); }
+			bool has_next() const { return const_item_pointer().has_next(); }
+			bool has_previous() const { return const_item_pointer().has_previous(); }
+			void set_to_beginning() { const_item_pointer().set_to_beginning(); }
+			void set_to_end_marker() { const_item_pointer().set_to_end_marker(); }
+			void set_to_next() { const_item_pointer().set_to_next(); }
+			void set_to_previous() { const_item_pointer().set_to_previous(); }
+			cipointer& operator ++() { const_item_pointer().set_to_next(); return (*this); }
 			cipointer operator++(int) { cipointer _Tmp = *this; ++*this; return (_Tmp); }
-			cipointer& operator --() { msevector_cipointer().operator --(); return (*this); }
+			cipointer& operator --() { const_item_pointer().set_to_previous(); return (*this); }
 			cipointer operator--(int) { cipointer _Tmp = *this; --*this; return (_Tmp); }
-			void advance(typename _MV::difference_type n) { msevector_cipointer().advance(n); }
-			void regress(typename _MV::difference_type n) { msevector_cipointer().regress(n); }
-			cipointer& operator +=(typename _MV::difference_type n) { msevector_cipointer().operator +=(n); return (*this); }
-			cipointer& operator -=(typename _MV::difference_type n) { msevector_cipointer().operator -=(n); return (*this); }
+			void advance(typename _MV::difference_type n) { const_item_pointer().advance(n); }
+			void regress(typename _MV::difference_type n) { const_item_pointer().regress(n); }
+			cipointer& operator +=(typename _MV::difference_type n) { const_item_pointer().advance(n); return (*this); }
+			cipointer& operator -=(typename _MV::difference_type n) { const_item_pointer().regress(n); return (*this); }
 			cipointer operator+(typename _MV::difference_type n) const { auto retval = (*this); retval += n; return retval; }
 			cipointer operator-(typename _MV::difference_type n) const { return ((*this) + (-n)); }
-			typename _MV::difference_type operator-(const cipointer& _Right_cref) const { return msevector_cipointer() - (_Right_cref.msevector_cipointer()); }
-			typename _MV::const_reference operator*() const { return msevector_cipointer().operator*(); }
+			typename _MV::difference_type operator-(const cipointer& _Right_cref) const { return const_item_pointer() - (_Right_cref.const_item_pointer()); }
+			typename _MV::const_reference operator*() const { return const_item_pointer().operator*(); }
 			typename _MV::const_reference item() const { return operator*(); }
-			typename _MV::const_reference previous_item() const { return msevector_cipointer().previous_item(); }
-			typename _MV::const_pointer operator->() const { return msevector_cipointer().operator->(); }
-			typename _MV::const_reference operator[](typename _MV::difference_type _Off) const { return (*(*this + _Off)); }
-			bool operator==(const cipointer& _Right_cref) const { return msevector_cipointer().operator==(_Right_cref.msevector_cipointer()); }
+			typename _MV::const_reference previous_item() const { return const_item_pointer().previous_item(); }
+			typename _MV::const_pointer operator->() const { return const_item_pointer().operator->(); }
+			typename _MV::const_reference operator[](typename _MV::difference_type _Off) const { return const_item_pointer()[_Off]; }
+			cipointer& operator=(const cipointer& _Right_cref) { m_node = _Right_cref.m_node; return (*this); }
+			bool operator==(const cipointer& _Right_cref) const { return const_item_pointer().operator==(_Right_cref.const_item_pointer()); }
 			bool operator!=(const cipointer& _Right_cref) const { return (!(_Right_cref == (*this))); }
-			bool operator<(const cipointer& _Right) const { return (msevector_cipointer() < _Right.msevector_cipointer()); }
-			bool operator<=(const cipointer& _Right) const { return (msevector_cipointer() <= _Right.msevector_cipointer()); }
-			bool operator>(const cipointer& _Right) const { return (msevector_cipointer() > _Right.msevector_cipointer()); }
-			bool operator>=(const cipointer& _Right) const { return (msevector_cipointer() >= _Right.msevector_cipointer()); }
-			void set_to_const_item_pointer(const cipointer& _Right_cref) { msevector_cipointer().set_to_const_item_pointer(_Right_cref.msevector_cipointer()); }
-			msev_size_t position() const { return msevector_cipointer().position(); }
-			auto target_container_ptr() const -> decltype(msevector_cipointer().target_container_ptr()) {
-				return msevector_cipointer().target_container_ptr();
+			bool operator<(const cipointer& _Right) const { return (const_item_pointer() < _Right.const_item_pointer()); }
+			bool operator<=(const cipointer& _Right) const { return (const_item_pointer() <= _Right.const_item_pointer()); }
+			bool operator>(const cipointer& _Right) const { return (const_item_pointer() > _Right.const_item_pointer()); }
+			bool operator>=(const cipointer& _Right) const { return (const_item_pointer() >= _Right.const_item_pointer()); }
+			void set_to_const_item_pointer(const cipointer& _Right_cref) { const_item_pointer().set_to_const_item_pointer(_Right_cref.const_item_pointer()); }
+			msev_size_t position() const { return const_item_pointer().position(); }
+			auto target_container_ptr() const {
+				return m_node.owner_ptr();
 			}
 			void async_not_shareable_and_not_passable_tag() const {}
 		private:
-			cipointer(const std::shared_ptr<_MV>& msevector_shptr) : m_msevector_cshptr(msevector_shptr), m_cipointer(*msevector_shptr) {}
-			std::shared_ptr<const _MV> m_msevector_cshptr;
-			/* m_cipointer needs to be declared after m_msevector_cshptr so that it's destructor will be called first. */
-			typename _MV::cipointer m_cipointer;
+			cipointer(const mse::TRefCountingPointer<_MV>& msevector_refcptr) : m_msevector_crefcptr(msevector_refcptr), m_node(*msevector_refcptr) {}
+			mse::TRefCountingConstPointer<_MV> m_msevector_crefcptr;
+			/* m_node needs to be declared after m_msevector_crefcptr so that it's destructor will be called first. */
+			typename _MV::mm_intrusive_const_iterator_node_type m_node;
 			friend class /*_Myt*/ivector<_Ty, _A>;
 			friend class ipointer;
 		};
@@ -188,66 +192,64 @@ namespace mse {
 			typedef typename _MV::mm_iterator_type::pointer pointer;
 			typedef typename _MV::mm_iterator_type::reference reference;
 
-			ipointer(_Myt& owner_ref) : m_msevector_shptr(owner_ref.m_shptr), m_ipointer(*(owner_ref.m_shptr)) {}
-			ipointer(const ipointer& src_cref) : m_msevector_shptr(src_cref.m_msevector_shptr), m_ipointer(src_cref.m_ipointer) {}
+			ipointer(_Myt& owner_ref) : m_msevector_refcptr(owner_ref.m_refcptr), m_node(*(owner_ref.m_refcptr)) {}
+			ipointer(const ipointer& src_cref) : m_msevector_refcptr(src_cref.m_msevector_refcptr), m_node(src_cref.m_node) {}
 			~ipointer() {}
-			const typename _MV::ipointer& msevector_ipointer() const { return m_ipointer; }
-			typename _MV::ipointer& msevector_ipointer() { return m_ipointer; }
-			const typename _MV::ipointer& mvip() const { return msevector_ipointer(); }
-			typename _MV::ipointer& mvip() { return msevector_ipointer(); }
+			typename _MV::mm_iterator_type& item_pointer() const { return m_node.mm_iterator(); }
+			typename _MV::mm_iterator_type& ip() const { return item_pointer(); }
 			operator cipointer() const {
-				cipointer retval(m_msevector_shptr);
-				assert(m_msevector_shptr);
-				retval.set_to_beginning();
-				retval.advance(msev_int(msevector_ipointer().position()));
+				cipointer retval(m_msevector_refcptr);
+				assert(m_msevector_refcptr);
+				retval.advance(msev_int(position()));
 				return retval;
 			}
 
-			void reset() { msevector_ipointer().reset(); }
-			bool points_to_an_item() const { return msevector_ipointer().points_to_an_item(); }
-			bool points_to_end_marker() const { return msevector_ipointer().points_to_end_marker(); }
-			bool points_to_beginning() const { return msevector_ipointer().points_to_beginning(); }
+			void reset() { item_pointer().reset(); }
+			bool points_to_an_item() const { return item_pointer().points_to_an_item(); }
+			bool points_to_end_marker() const { return item_pointer().points_to_end_marker(); }
+			bool points_to_beginning() const { return item_pointer().points_to_beginning(); }
 			/* has_next_item_or_end_marker() is just an alias for points_to_an_item(). */
-			bool has_next_item_or_end_marker() const { return msevector_ipointer().has_next_item_or_end_marker(); }
+			bool has_next_item_or_end_marker() const { return item_pointer().has_next_item_or_end_marker(); }
 			/* has_next() is just an alias for points_to_an_item() that's familiar to java programmers. */
-			bool has_next() const { return msevector_ipointer().has_next(); }
-			bool has_previous() const { return msevector_ipointer().has_previous(); }
-			void set_to_beginning() { msevector_ipointer().set_to_beginning(); }
-			void set_to_end_marker() { msevector_ipointer().set_to_end_marker(); }
-			void set_to_next() { msevector_ipointer().set_to_next(); }
-			void set_to_previous() { msevector_ipointer().set_to_previous(); }
-			ipointer& operator ++() { msevector_ipointer().operator ++(); return (*this); }
+			bool has_next() const { return item_pointer().has_next(); }
+			bool has_previous() const { return item_pointer().has_previous(); }
+			void set_to_beginning() { item_pointer().set_to_beginning(); }
+			void set_to_end_marker() { item_pointer().set_to_end_marker(); }
+			void set_to_next() { item_pointer().set_to_next(); }
+			void set_to_previous() { item_pointer().set_to_previous(); }
+			ipointer& operator ++() { item_pointer().set_to_next(); return (*this); }
 			ipointer operator++(int) { ipointer _Tmp = *this; ++*this; return (_Tmp); }
-			ipointer& operator --() { msevector_ipointer().operator --(); return (*this); }
+			ipointer& operator --() { item_pointer().set_to_previous(); return (*this); }
 			ipointer operator--(int) { ipointer _Tmp = *this; --*this; return (_Tmp); }
-			void advance(typename _MV::difference_type n) { msevector_ipointer().advance(n); }
-			void regress(typename _MV::difference_type n) { msevector_ipointer().regress(n); }
-			ipointer& operator +=(typename _MV::difference_type n) { msevector_ipointer().operator +=(n); return (*this); }
-			ipointer& operator -=(typename _MV::difference_type n) { msevector_ipointer().operator -=(n); return (*this); }
+			void advance(typename _MV::difference_type n) { item_pointer().advance(n); }
+			void regress(typename _MV::difference_type n) { item_pointer().regress(n); }
+			ipointer& operator +=(typename _MV::difference_type n) { item_pointer().advance(n); return (*this); }
+			ipointer& operator -=(typename _MV::difference_type n) { item_pointer().regress(n); return (*this); }
 			ipointer operator+(typename _MV::difference_type n) const { auto retval = (*this); retval += n; return retval; }
 			ipointer operator-(typename _MV::difference_type n) const { return ((*this) + (-n)); }
-			typename _MV::difference_type operator-(const ipointer& _Right_cref) const { return msevector_ipointer() - (_Right_cref.msevector_ipointer()); }
-			typename _MV::reference operator*() const { return msevector_ipointer().operator*(); }
+			typename _MV::difference_type operator-(const ipointer& _Right_cref) const { return item_pointer() - (_Right_cref.item_pointer()); }
+			typename _MV::reference operator*() const { return item_pointer().operator*(); }
 			typename _MV::reference item() const { return operator*(); }
-			typename _MV::reference previous_item() const { return msevector_ipointer().previous_item(); }
-			typename _MV::pointer operator->() const { return msevector_ipointer().operator->(); }
-			typename _MV::reference operator[](typename _MV::difference_type _Off) const { return (*(*this + _Off)); }
-			bool operator==(const ipointer& _Right_cref) const { return msevector_ipointer().operator==(_Right_cref.msevector_ipointer()); }
+			typename _MV::reference previous_item() const { return item_pointer().previous_item(); }
+			typename _MV::pointer operator->() const { return item_pointer().operator->(); }
+			typename _MV::reference operator[](typename _MV::difference_type _Off) const { return item_pointer()[_Off]; }
+			ipointer& operator=(const ipointer& _Right_cref) { m_node = _Right_cref.m_node; return (*this); }
+			bool operator==(const ipointer& _Right_cref) const { return item_pointer().operator==(_Right_cref.item_pointer()); }
 			bool operator!=(const ipointer& _Right_cref) const { return (!(_Right_cref == (*this))); }
-			bool operator<(const ipointer& _Right) const { return (msevector_ipointer() < _Right.msevector_ipointer()); }
-			bool operator<=(const ipointer& _Right) const { return (msevector_ipointer() <= _Right.msevector_ipointer()); }
-			bool operator>(const ipointer& _Right) const { return (msevector_ipointer() > _Right.msevector_ipointer()); }
-			bool operator>=(const ipointer& _Right) const { return (msevector_ipointer() >= _Right.msevector_ipointer()); }
-			void set_to_item_pointer(const ipointer& _Right_cref) { msevector_ipointer().set_to_item_pointer(_Right_cref.msevector_ipointer()); }
-			auto target_container_ptr() const -> decltype(msevector_ipointer().target_container_ptr()) {
-				return msevector_ipointer().target_container_ptr();
+			bool operator<(const ipointer& _Right) const { return (item_pointer() < _Right.item_pointer()); }
+			bool operator<=(const ipointer& _Right) const { return (item_pointer() <= _Right.item_pointer()); }
+			bool operator>(const ipointer& _Right) const { return (item_pointer() > _Right.item_pointer()); }
+			bool operator>=(const ipointer& _Right) const { return (item_pointer() >= _Right.item_pointer()); }
+			void set_to_item_pointer(const ipointer& _Right_cref) { item_pointer().set_to_item_pointer(_Right_cref.item_pointer()); }
+			auto target_container_ptr() const {
+				return m_node.owner_ptr();
 			}
 			void async_not_shareable_and_not_passable_tag() const {}
-			msev_size_t position() const { return msevector_ipointer().position(); }
+			msev_size_t position() const { return item_pointer().position(); }
 		private:
-			std::shared_ptr<_MV> m_msevector_shptr;
-			/* m_ipointer needs to be declared after m_msevector_shptr so that it's destructor will be called first. */
-			typename _MV::ipointer m_ipointer;
+			mse::TRefCountingPointer<_MV> m_msevector_refcptr;
+			/* m_node needs to be declared after m_msevector_refcptr so that it's destructor will be called first. */
+			typename _MV::mm_intrusive_iterator_node_type m_node;
 			friend class /*_Myt*/ivector<_Ty, _A>;
 		};
 
@@ -255,105 +257,107 @@ namespace mse {
 		set_to_beginning() and set_to_end_marker() member functions are preferred. */
 		ipointer begin() {	// return ipointer for beginning of mutable sequence
 			ipointer retval(*this);
-			retval.m_ipointer.set_to_beginning();
+			retval.set_to_beginning();
 			return retval;
 		}
 		cipointer begin() const {	// return ipointer for beginning of nonmutable sequence
 			cipointer retval(*this);
-			retval.m_cipointer.set_to_beginning();
+			retval.set_to_beginning();
 			return retval;
 		}
 		ipointer end() {	// return ipointer for end of mutable sequence
 			ipointer retval(*this);
-			retval.m_ipointer.set_to_end_marker();
+			retval.set_to_end_marker();
 			return retval;
 		}
 		cipointer end() const {	// return ipointer for end of nonmutable sequence
 			cipointer retval(*this);
-			retval.m_cipointer.set_to_end_marker();
+			retval.set_to_end_marker();
 			return retval;
 		}
 		cipointer cbegin() const {	// return ipointer for beginning of nonmutable sequence
 			cipointer retval(*this);
-			retval.m_cipointer.set_to_beginning();
+			retval.set_to_beginning();
 			return retval;
 		}
 		cipointer cend() const {	// return ipointer for end of nonmutable sequence
 			cipointer retval(*this);
-			retval.m_cipointer.set_to_beginning();
+			retval.set_to_end_marker();
 			return retval;
 		}
 
 		ivector(const cipointer &start, const cipointer &end, const _A& _Al = _A())
-			: m_shptr(std::make_shared<_MV>(start.msevector_cipointer(), end.msevector_cipointer(), _Al)) {}
+			: m_refcptr(mse::make_refcounting<_MV>(_Al)) {
+			m_refcptr->assign(start.const_item_pointer(), end.const_item_pointer());
+		}
 		void assign(const cipointer &start, const cipointer &end) {
-			m_shptr->assign(start.msevector_cipointer(), end.msevector_cipointer());
+			m_refcptr->assign(start.const_item_pointer(), end.const_item_pointer());
 		}
 		void assign_inclusive(const cipointer &first, const cipointer &last) {
-			m_shptr->assign_inclusive(first.msevector_cipointer(), last.msevector_cipointer());
+			m_refcptr->assign_inclusive(first.const_item_pointer(), last.const_item_pointer());
 		}
 		ipointer insert_before(const cipointer &pos, size_type _M, const _Ty& _X) {
-			auto res = m_shptr->insert_before(pos.msevector_cipointer(), _M, _X);
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->insert_before(pos.const_item_pointer(), _M, _X);
+			return ipointer_at(original_pos);
 		}
 		ipointer insert_before(const cipointer &pos, _Ty&& _X) {
-			auto res = m_shptr->insert_before(pos.msevector_cipointer(), std::forward<decltype(_X)>(_X));
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->insert_before(pos.const_item_pointer(), std::forward<decltype(_X)>(_X));
+			return ipointer_at(original_pos);
 		}
 		ipointer insert_before(const cipointer &pos, const _Ty& _X = _Ty()) { return insert_before(pos, 1, _X); }
 		ipointer insert_before(const cipointer &pos, const cipointer &start, const cipointer &end) {
-			auto res = m_shptr->insert_before(pos.msevector_cipointer(), start.msevector_cipointer(), end.msevector_cipointer());
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->insert_before(pos.const_item_pointer(), start, end);
+			return ipointer_at(original_pos);
 		}
 		ipointer insert_before_inclusive(const cipointer &pos, const cipointer &first, const cipointer &last) {
 			auto end = last; end.set_to_next();
 			return insert_before(pos, first, end);
 		}
 		ipointer insert_before(const cipointer &pos, _XSTD initializer_list<typename _MV::value_type> _Ilist) {	// insert initializer_list
-			auto res = m_shptr->insert_before(pos.msevector_cipointer(), _Ilist);
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->insert_before(pos.const_item_pointer(), _Ilist);
+			return ipointer_at(original_pos);
 		}
 		void insert_before(msev_size_t pos, _Ty&& _X) {
-			m_shptr->insert_before(pos, std::forward<decltype(_X)>(_X));
+			m_refcptr->insert_before(pos, std::forward<decltype(_X)>(_X));
 		}
 		void insert_before(msev_size_t pos, const _Ty& _X = _Ty()) {
-			m_shptr->insert_before(pos, _X);
+			m_refcptr->insert_before(pos, _X);
 		}
 		void insert_before(msev_size_t pos, size_type _M, const _Ty& _X) {
-			m_shptr->insert_before(pos, _M, _X);
+			m_refcptr->insert_before(pos, _M, _X);
 		}
 		void insert_before(msev_size_t pos, _XSTD initializer_list<typename _MV::value_type> _Ilist) {	// insert initializer_list
-			m_shptr->insert_before(pos, _Ilist);
+			m_refcptr->insert_before(pos, _Ilist);
 		}
 		template<class ..._Valty>
 		ipointer emplace(const cipointer &pos, _Valty&& ..._Val) {
-			auto res = m_shptr->emplace(pos.msevector_cipointer(), std::forward<_Valty>(_Val)...);
-			ipointer retval = begin(); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->emplace(pos.const_item_pointer(), std::forward<_Valty>(_Val)...);
+			return ipointer_at(original_pos);
 		}
 		ipointer erase(const ipointer &pos) {
-			auto res = m_shptr->erase(pos.msevector_ipointer());
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = pos.position();
+			m_refcptr->erase(pos.item_pointer());
+			return ipointer_at(original_pos);
 		}
 		ipointer erase(const ipointer &start, const ipointer &end) {
-			auto res = m_shptr->erase(start.msevector_ipointer(), end.msevector_ipointer());
-			ipointer retval(*this); retval.msevector_ipointer() = res;
-			return retval;
+			msev_size_t original_pos = start.position();
+			m_refcptr->erase(start.item_pointer(), end.item_pointer());
+			return ipointer_at(original_pos);
 		}
 		ipointer erase_inclusive(const ipointer &first, const ipointer &last) {
 			auto end = last; end.set_to_next();
-			return erase_inclusive(first, end);
+			return erase(first, end);
 		}
 		bool operator==(const _Myt& _Right) const {	// test for ivector equality
-			return ((*(_Right.m_shptr)) == (*m_shptr));
+			return ((*(_Right.m_refcptr)) == (*m_refcptr));
 		}
 		bool operator<(const _Myt& _Right) const {	// test if _Left < _Right for ivectors
-			return ((*m_shptr) < (*(_Right.m_shptr)));
+			return ((*m_refcptr) < (*(_Right.m_refcptr)));
 		}
 
 		/* These static functions are just used to obtain a (base class) reference to an
@@ -361,6 +365,15 @@ namespace mse {
 		static _MV& _MV_ref(_MV& obj) { return obj; }
 		static const _MV& _MV_cref(const _MV& obj) { return obj; }
 
+	private:
+		ipointer ipointer_at(msev_size_t index) {
+			ipointer retval(*this);
+			retval.advance(msev_int(index));
+			return retval;
+		}
+
+	public:
+
 		class xscope_cipointer : public _MV::random_access_iterator_base, public mse::us::impl::XScopeTagBase {
 		public:
 			typedef typename _MV::cipointer::iterator_category iterator_category;
@@ -371,14 +384,14 @@ namespace mse {
 			typedef typename _MV::cipointer::reference reference;
 
 			xscope_cipointer(const mse::TXScopeObjFixedConstPointer<ivector>& owner_ptr)
-				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 			xscope_cipointer(const mse::TXScopeObjFixedPointer<ivector>& owner_ptr)
-				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 			xscope_cipointer(const mse::TXScopeFixedConstPointer<ivector>& owner_ptr)
-				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 			xscope_cipointer(const mse::TXScopeFixedPointer<ivector>& owner_ptr)
-				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_cipointer(mse::make_xscope_const_pointer_to_member(_MV_cref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 
 			xscope_cipointer(const xscope_cipointer& src_cref) : m_xscope_cipointer(src_cref.m_xscope_cipointer) {}
@@ -478,10 +491,10 @@ namespace mse {
 			typedef typename _MV::ipointer::reference reference;
 
 			xscope_ipointer(const mse::TXScopeObjFixedPointer<ivector>& owner_ptr)
-				: m_xscope_ipointer(mse::make_xscope_pointer_to_member(_MV_ref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_ipointer(mse::make_xscope_pointer_to_member(_MV_ref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 			xscope_ipointer(const mse::TXScopeFixedPointer<ivector>& owner_ptr)
-				: m_xscope_ipointer(mse::make_xscope_pointer_to_member(_MV_ref(*((*owner_ptr).m_shptr)), owner_ptr)) {}
+				: m_xscope_ipointer(mse::make_xscope_pointer_to_member(_MV_ref(*((*owner_ptr).m_refcptr)), owner_ptr)) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 
 			xscope_ipointer(const xscope_ipointer& src_cref) : m_xscope_ipointer(src_cref.m_xscope_ipointer) {}
@@ -570,10 +583,10 @@ namespace mse {
 			xscope_structure_lock_guard(xscope_structure_lock_guard&&) = default;
 
 			xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<ivector>& owner_ptr)
-				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_refcptr))) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 			xscope_structure_lock_guard(const mse::TXScopeFixedPointer<ivector>& owner_ptr)
-				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_refcptr))) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 		};
 		class xscope_const_structure_lock_guard : public mse::us::impl::Txscope_const_structure_lock_guard_of_wrapper<ivector, typename mse::us::msevector<_Ty>::xscope_const_structure_lock_guard> {
@@ -584,10 +597,10 @@ namespace mse {
 			xscope_const_structure_lock_guard(xscope_const_structure_lock_guard&&) = default;
 
 			xscope_const_structure_lock_guard(const mse::TXScopeObjFixedConstPointer<ivector>& owner_ptr)
-				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_refcptr))) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 			xscope_const_structure_lock_guard(const mse::TXScopeFixedConstPointer<ivector>& owner_ptr)
-				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+				: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_refcptr))) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 		};
 
@@ -595,7 +608,7 @@ namespace mse {
 		void async_not_shareable_and_not_passable_tag() const {}
 
 	private:
-		std::shared_ptr<_MV> m_shptr;
+		mse::TRefCountingPointer<_MV> m_refcptr;
 	};
 
 #ifdef MSE_HAS_CXX17
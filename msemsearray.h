@@ -36,7 +36,7 @@
 #include <array>
 #include <cassert>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 #include <tuple>
 #include <limits>
 #include <climits>       // ULONG_MAX
@@ -45,6 +45,7 @@
 //include <shared_mutex>
 //include <mutex>
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #ifdef MSE_HAS_CXX17
 //include <variant>
@@ -587,6 +588,15 @@ namespace mse {
 
 		template<class _TIterator, class = typename std::enable_if<(is_contiguous_sequence_static_structure_or_locking_strong_iterator_msemsearray<_TIterator>::value), void>::type>
 		void T_valid_if_is_contiguous_sequence_static_structure_or_locking_strong_iterator_msemsearray() {}
+
+		/* Unlike the traits above, this one is not relaxed when some of the safe iterator types are disabled, because it
+		is used to select an implementation (that relies on the elements being contiguous and staying put), not just to
+		validate a usage. */
+		template <typename _TIterator> struct has_stable_contiguous_elements_strong_iterator_msemsearray : std::integral_constant<bool,
+			(std::is_base_of<mse::us::impl::ContiguousSequenceIteratorTagBase, typename std::remove_reference<_TIterator>::type>::value)
+			&& is_strong_container_reference_holding_iterator<_TIterator>::value
+			&& ((std::is_base_of<mse::us::impl::StaticStructureIteratorTagBase, typename std::remove_reference<_TIterator>::type>::value)
+				|| (std::is_base_of<mse::us::impl::StructureLockingIteratorTagBase, typename std::remove_reference<_TIterator>::type>::value))> {};
 	}
 
 	namespace impl {
@@ -1732,6 +1742,8 @@ namespace mse {
 	template<class _InIt, class _Pr, class... Args> inline _InIt find_if_ptr(const _InIt& _First, const _InIt& _Last, _Pr _Pred, const Args&... args);
 	template<class _InIt, class _Fn, class... Args> inline auto for_each_ptr(const _InIt& _First, const _InIt& _Last, _Fn _Func, const Args&... args);
 	template<class _RanIt> inline void sort(const _RanIt& _First, const _RanIt& _Last);
+	template<class _InIt, class _OutIt> inline _OutIt copy(const _InIt& _First, const _InIt& _Last, _OutIt _Dest);
+	template<class _InIt, class _OutIt, class _Fn> inline _OutIt transform(const _InIt& _First, const _InIt& _Last, _OutIt _Dest, _Fn _Func);
 
 	namespace impl {
 
@@ -1797,6 +1809,22 @@ namespace mse {
 		auto make_xscope_specialized_first_and_last_overloaded(const TXScopeCSSSStrongRAIterator<_TRAContainerPointer>& _First, const TXScopeCSSSStrongRAIterator<_TRAContainerPointer>& _Last) {
 			return TXScopeSpecializedFirstAndLast<TXScopeCSSSStrongRAIterator<_TRAContainerPointer> >(_First, _Last);
 		}
+
+		/* TRA(Const)Iterator<>s don't hold a structure lock, but if they hold a strong pointer to a container with contiguous
+		storage and a static structure (like nii_array<>), then raw pointers to its elements remain valid for as long as the
+		iterators do. In those cases we can bounds check the iterator range once and then hand the algorithm raw pointers. */
+		template <typename _TRAContainerPointer> struct is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray : std::integral_constant<bool,
+			is_strong_ptr<typename std::remove_reference<_TRAContainerPointer>::type>::value
+			&& is_contiguous_sequence_static_structure_container_msemsearray<typename std::remove_reference<decltype(*std::declval<_TRAContainerPointer>())>::type>::value> {};
+
+		template <typename _TRAContainerPointer, class = typename std::enable_if<(is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+		auto make_xscope_specialized_first_and_last_overloaded(const TRAConstIterator<_TRAContainerPointer>& _First, const TRAConstIterator<_TRAContainerPointer>& _Last) {
+			return TXScopeRawPointerRAFirstAndLast<TRAConstIterator<_TRAContainerPointer> >(_First, _Last);
+		}
+		template <typename _TRAContainerPointer, class = typename std::enable_if<(is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+		auto make_xscope_specialized_first_and_last_overloaded(const TRAIterator<_TRAContainerPointer>& _First, const TRAIterator<_TRAContainerPointer>& _Last) {
+			return TXScopeRawPointerRAFirstAndLast<TRAIterator<_TRAContainerPointer> >(_First, _Last);
+		}
 	}
 }
 
@@ -1832,6 +1860,32 @@ namespace std {
 	inline void sort(const mse::TXScopeCSSSStrongRAIterator<_TRAContainerPointer>& _First, const mse::TXScopeCSSSStrongRAIterator<_TRAContainerPointer>& _Last) {
 		mse::sort(_First, _Last);
 	}
+
+	/* Overloads of standard algorithm functions for TRA(Const)Iterator<>s that hold a strong pointer to a contiguous, static
+	structure container. (Other TRA(Const)Iterator<>s are handled by the standard implementations.) */
+
+	template <typename _TRAContainerPointer, class = typename std::enable_if<(mse::impl::is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+	inline void sort(const mse::TRAIterator<_TRAContainerPointer>& _First, const mse::TRAIterator<_TRAContainerPointer>& _Last) {
+		mse::sort(_First, _Last);
+	}
+
+	template<class _OutIt, typename _TRAContainerPointer, class = typename std::enable_if<(mse::impl::is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+	inline _OutIt copy(const mse::TRAConstIterator<_TRAContainerPointer>& _First, const mse::TRAConstIterator<_TRAContainerPointer>& _Last, _OutIt _Dest) {
+		return mse::copy(_First, _Last, _Dest);
+	}
+	template<class _OutIt, typename _TRAContainerPointer, class = typename std::enable_if<(mse::impl::is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+	inline _OutIt copy(const mse::TRAIterator<_TRAContainerPointer>& _First, const mse::TRAIterator<_TRAContainerPointer>& _Last, _OutIt _Dest) {
+		return mse::copy(_First, _Last, _Dest);
+	}
+
+	template<class _OutIt, class _Fn, typename _TRAContainerPointer, class = typename std::enable_if<(mse::impl::is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+	inline _OutIt transform(const mse::TRAConstIterator<_TRAContainerPointer>& _First, const mse::TRAConstIterator<_TRAContainerPointer>& _Last, _OutIt _Dest, _Fn _Func) {
+		return mse::transform(_First, _Last, _Dest, _Func);
+	}
+	template<class _OutIt, class _Fn, typename _TRAContainerPointer, class = typename std::enable_if<(mse::impl::is_contiguous_sequence_static_structure_strong_ra_container_pointer_msemsearray<_TRAContainerPointer>::value), void>::type>
+	inline _OutIt transform(const mse::TRAIterator<_TRAContainerPointer>& _First, const mse::TRAIterator<_TRAContainerPointer>& _Last, _OutIt _Dest, _Fn _Func) {
+		return mse::transform(_First, _Last, _Dest, _Func);
+	}
 }
 
 namespace mse {
@@ -4812,6 +4866,138 @@ namespace mse {
 			}
 		};
 
+		/* Implementations of the bulk operations of the random access sections. The "first" parameters may be (bounds
+		checked) iterators or, when the section's iterator type ensures that its (contiguous) elements stay put, raw
+		pointers. Either way, the caller is responsible for having verified that the given ranges are in bounds. */
+		struct ra_section_bulk_op_helpers {
+			template <typename _TFirst, typename _Ty>
+			static void fill(const _TFirst& first, size_t n, const _Ty& value) {
+				std::fill_n(first, n, value);
+			}
+
+			template <typename _TFirst, typename _TSrcFirst>
+			static void copy(const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				typedef typename std::remove_pointer<_TFirst>::type target_element_t;
+				copy_helper1(typename std::integral_constant<bool, std::is_pointer<_TFirst>::value && std::is_pointer<_TSrcFirst>::value
+					&& std::is_same<typename std::remove_const<typename std::remove_pointer<_TSrcFirst>::type>::type, target_element_t>::value
+					&& std::is_trivially_copyable<target_element_t>::value>::type(), first, src_first, n);
+			}
+
+			/* Like copy(), the source and target may be (overlapping) sections of the same container. */
+			template <typename _TFirst, typename _TSrcFirst, typename _Fn>
+			static void transform(const _TFirst& first, const _TSrcFirst& src_first, size_t n, _Fn& func) {
+				if (target_follows_source_start(first, src_first, n)) {
+					for (size_t i = n; 0 != i;) {
+						--i;
+						first[std::ptrdiff_t(i)] = func(src_first[std::ptrdiff_t(i)]);
+					}
+				}
+				else {
+					for (size_t i = 0; i < n; i += 1) {
+						first[std::ptrdiff_t(i)] = func(src_first[std::ptrdiff_t(i)]);
+					}
+				}
+			}
+
+			template <typename _TFirst, typename _Ty, typename _Fn>
+			static _Ty reduce(const _TFirst& first, size_t n, _Ty init, _Fn& func) {
+				for (size_t i = 0; i < n; i += 1) {
+					init = func(std::move(init), first[std::ptrdiff_t(i)]);
+				}
+				return init;
+			}
+
+			template <typename _TFirst1, typename _TFirst2>
+			static int compare(const _TFirst1& first1, const _TFirst2& first2, size_t n) {
+				for (size_t i = 0; i < n; i += 1) {
+					const auto& element1_cref = first1[std::ptrdiff_t(i)];
+					const auto& element2_cref = first2[std::ptrdiff_t(i)];
+					if (element1_cref < element2_cref) {
+						return -1;
+					}
+					else if (element2_cref < element1_cref) {
+						return 1;
+					}
+				}
+				return 0;
+			}
+
+		private:
+			template <typename _TFirst, typename _TSrcFirst>
+			static void copy_helper1(std::true_type, const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				std::memmove(first, src_first, n * sizeof(*first));
+			}
+			template <typename _TFirst, typename _TSrcFirst>
+			static void copy_helper1(std::false_type, const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				/* The source and target may be (overlapping) sections of the same container, in which case the copy needs
+				to proceed in the appropriate direction. */
+				if (target_follows_source_start(first, src_first, n)) {
+					for (size_t i = n; 0 != i;) {
+						--i;
+						first[std::ptrdiff_t(i)] = src_first[std::ptrdiff_t(i)];
+					}
+				}
+				else {
+					for (size_t i = 0; i < n; i += 1) {
+						first[std::ptrdiff_t(i)] = src_first[std::ptrdiff_t(i)];
+					}
+				}
+			}
+
+			template <typename _TFirst> struct is_contiguous_first : std::integral_constant<bool, std::is_pointer<_TFirst>::value
+				|| std::is_base_of<mse::us::impl::ContiguousSequenceIteratorTagBase, _TFirst>::value> {};
+
+			/* Returns whether a forward (element by element) pass could overwrite source elements before they are read. */
+			template <typename _TFirst, typename _TSrcFirst>
+			static bool target_follows_source_start(const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				return target_follows_source_start_helper1(typename std::integral_constant<bool, is_contiguous_first<_TFirst>::value
+					&& is_contiguous_first<_TSrcFirst>::value>::type(), first, src_first, n);
+			}
+			template <typename _TFirst, typename _TSrcFirst>
+			static bool target_follows_source_start_helper1(std::true_type, const _TFirst& first, const _TSrcFirst& src_first, size_t /*n*/) {
+				return std::less<const void*>()(std::addressof(src_first[0]), std::addressof(first[0]));
+			}
+			template <typename _TFirst, typename _TSrcFirst>
+			static bool target_follows_source_start_helper1(std::false_type, const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				/* The relative addresses of elements that aren't (known to be) contiguous don't indicate their relative
+				positions, but iterators that expose their target container and position can be compared directly. */
+				return target_follows_source_start_helper2(typename std::integral_constant<bool, has_container_and_position<_TFirst>::value
+					&& has_container_and_position<_TSrcFirst>::value>::type(), first, src_first, n);
+			}
+			template <typename _TFirst, typename _TSrcFirst>
+			static bool target_follows_source_start_helper2(std::true_type, const _TFirst& first, const _TSrcFirst& src_first, size_t /*n*/) {
+				/* Sections of different containers don't overlap. */
+				if (static_cast<const void*>(std::addressof(*(first.target_container_ptr())))
+					!= static_cast<const void*>(std::addressof(*(src_first.target_container_ptr())))) {
+					return false;
+				}
+				return (std::ptrdiff_t(src_first.position()) < std::ptrdiff_t(first.position()));
+			}
+			template <typename _TFirst, typename _TSrcFirst>
+			static bool target_follows_source_start_helper2(std::false_type, const _TFirst& first, const _TSrcFirst& src_first, size_t n) {
+				/* Lacking any other information, we look for the target's first element among the source elements. */
+				const void* target_start_ptr = std::addressof(first[0]);
+				for (size_t i = 1; i < n; i += 1) {
+					if (std::addressof(src_first[std::ptrdiff_t(i)]) == target_start_ptr) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			template<class T>
+			struct has_container_and_position_impl {
+				template<class U>
+				static auto test(U*) -> decltype(std::addressof(*(std::declval<const U&>().target_container_ptr())), std::ptrdiff_t(std::declval<const U&>().position()), bool(true));
+				template<typename>
+				static auto test(...)->std::false_type;
+
+				using type = typename std::is_same<bool, decltype(test<T>(0))>::type;
+			};
+			template<class T>
+			struct has_container_and_position : has_container_and_position_impl<typename std::remove_reference<T>::type>::type {};
+		};
+
 		namespace ra_section {
 			template <typename _Ty> using mkxsracsh1_TRAIterator = typename std::remove_reference<decltype(mse::impl::ra_const_section_helpers::s_xscope_iter_from_lone_param(std::declval<mse::TXScopeFixedConstPointer<_Ty> >()))>::type;
 			template <typename _Ty> using mkxsracsh1_ReturnType = mse::TXScopeCagedRandomAccessConstSectionToRValue<mkxsracsh1_TRAIterator<_Ty> >;
@@ -4852,24 +5038,27 @@ namespace mse {
 					mse::impl::random_access_const_iterator_base<typename std::remove_reference<decltype(std::declval<_TRAIterator>()[0])>::type>);
 
 				//TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) = default;
-				TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
-				TRandomAccessConstSectionBase(const TRandomAccessSectionBase<_TRAIterator>& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
-				TRandomAccessConstSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter) {}
+				TRandomAccessConstSectionBase(const TRandomAccessConstSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter), m_start_ptr(src.m_start_ptr) {}
+				TRandomAccessConstSectionBase(const TRandomAccessSectionBase<_TRAIterator>& src) : m_count(src.m_count), m_start_iter(src.m_start_iter), m_start_ptr(src.m_start_ptr) {}
+				TRandomAccessConstSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter)
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 
 				template <typename _TRALoneParam>
 				TRandomAccessConstSectionBase(const _TRALoneParam& param)
 					/* _TRALoneParam being either another TRandomAccess(Const)SectionBase<> or a pointer to "random access" container is
 					supported. Different initialization implementations are required for each of the two cases. */
 					: m_count(s_count_from_lone_param(param))
-					, m_start_iter(s_xscope_iter_from_lone_param(param)) {}
+					, m_start_iter(s_xscope_iter_from_lone_param(param))
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 				template <typename _TRALoneParam>
 				TRandomAccessConstSectionBase(_TRALoneParam&& param)
 					: m_count(s_count_from_lone_param(param))
-					, m_start_iter(s_xscope_iter_from_lone_param(std::forward<decltype(param)>(param))) {}
+					, m_start_iter(s_xscope_iter_from_lone_param(std::forward<decltype(param)>(param)))
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 
 				const_reference operator[](size_type _P) const {
 					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TRandomAccessConstSectionBase")); }
-					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
+					return element_at(has_stable_contiguous_elements_t(), _P);
 				}
 				const_reference at(size_type _P) const {
 					return (*this)[_P];
@@ -4993,6 +5182,7 @@ namespace mse {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_prefix() - TRandomAccessConstSectionBase")); }
 					m_count -= n;
 					m_start_iter += n;
+					s_advance_start_ptr(has_stable_contiguous_elements_t(), m_start_ptr, n);
 				}
 				void remove_suffix(size_type n) /*_NOEXCEPT*/ {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_suffix() - TRandomAccessConstSectionBase")); }
@@ -5175,6 +5365,28 @@ namespace mse {
 					return (!empty()) && (back() == c);
 				}
 
+				/* Bulk operations. The bounds are checked once per call rather than on each element access. And when the
+				iterator type ensures that the (contiguous) elements stay put, the operations work directly on raw pointers. */
+				template<typename _Ty2, typename _Fn = std::plus<> >
+				_Ty2 reduce(_Ty2 init, _Fn func = _Fn()) const {
+					if (0 == (*this).size()) {
+						return init;
+					}
+					return mse::impl::ra_section_bulk_op_helpers::reduce(bulk_op_first(), (*this).size(), std::move(init), func);
+				}
+				template<typename _TRAParam>
+				int compare(const _TRAParam& ra_param) const {
+					auto sv = mse::make_xscope_random_access_const_section(mse::rsv::as_an_fparam(ra_param));
+					auto common_count = std::min(mse::msear_as_a_size_t((*this).size()), mse::msear_as_a_size_t(sv.size()));
+					if (0 != common_count) {
+						auto retval = mse::impl::ra_section_bulk_op_helpers::compare(bulk_op_first(), sv.bulk_op_first(), common_count);
+						if (0 != retval) {
+							return retval;
+						}
+					}
+					return ((*this).size() < sv.size()) ? -1 : (((*this).size() > sv.size()) ? 1 : 0);
+				}
+
 				typedef typename std::conditional<mse::impl::is_instantiation_of<_TRAIterator, mse::TXScopeCSSSStrongRAConstIterator>::value
 					|| mse::impl::is_instantiation_of<_TRAIterator, mse::TXScopeCSSSStrongRAIterator>::value
 					|| mse::impl::is_instantiation_of<_TRAIterator, mse::TXScopeCSSSStrongRASectionConstIterator>::value
@@ -5230,8 +5442,54 @@ namespace mse {
 			private:
 				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
+				/* When the iterator type ensures that the (contiguous) elements stay put for as long as the iterator exists
+				(i.e. it holds a strong reference to a container that is either of static structure or "structure locked"),
+				the section also holds a raw pointer to its first element. The extent of the section is verified once, at
+				construction, and elements are subsequently accessed directly through the raw pointer. */
+				typedef typename mse::impl::has_stable_contiguous_elements_strong_iterator_msemsearray<_TRAIterator>::type has_stable_contiguous_elements_t;
+				typedef typename std::conditional<has_stable_contiguous_elements_t::value
+					, decltype(std::addressof(std::declval<const _TRAIterator&>()[0])), mse::impl::TPlaceHolder<> >::type start_ptr_t;
+
+				static start_ptr_t s_start_ptr(std::true_type, const _TRAIterator& start_iter, size_type count) {
+					if (0 == count) {
+						return nullptr;
+					}
+					/* Verifying that the last element of the section is in bounds. */
+					start_iter[difference_type(mse::msear_as_a_size_t(count - 1))];
+					return std::addressof(start_iter[0]);
+				}
+				static start_ptr_t s_start_ptr(std::false_type, const _TRAIterator& /*start_iter*/, size_type /*count*/) {
+					return start_ptr_t();
+				}
+				static void s_advance_start_ptr(std::true_type, start_ptr_t& start_ptr_ref, size_type n) {
+					if (0 != n) {
+						start_ptr_ref += n;
+					}
+				}
+				static void s_advance_start_ptr(std::false_type, start_ptr_t& start_ptr_ref, size_type n) {}
+
+				auto element_at(std::true_type, size_type _P) const -> decltype(std::declval<const _TRAIterator&>()[0]) {
+					return m_start_ptr[_P];
+				}
+				auto element_at(std::false_type, size_type _P) const -> decltype(std::declval<const _TRAIterator&>()[0]) {
+					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
+				}
+
+				/* Returns the raw pointer to the first element if available, otherwise the (bounds checked) start iterator.
+				Must only be called on nonempty sections. */
+				auto bulk_op_first() const {
+					return bulk_op_first_helper1(has_stable_contiguous_elements_t());
+				}
+				start_ptr_t bulk_op_first_helper1(std::true_type) const {
+					return m_start_ptr;
+				}
+				const _TRAIterator& bulk_op_first_helper1(std::false_type) const {
+					return m_start_iter;
+				}
+
 				size_type m_count = 0;
 				_TRAIterator m_start_iter;
+				start_ptr_t m_start_ptr;
 
 				friend class TXScopeRandomAccessConstSection<_TRAIterator>;
 				friend class TRandomAccessConstSection<_TRAIterator>;
@@ -5410,21 +5668,25 @@ namespace mse {
 					mse::impl::random_access_iterator_base<typename std::remove_reference<decltype(std::declval<_TRAIterator>()[0])>::type>);
 
 				//TRandomAccessSectionBase(const TRandomAccessSectionBase& src) = default;
-				TRandomAccessSectionBase(const TRandomAccessSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter) {}
-				TRandomAccessSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter) {}
+				TRandomAccessSectionBase(const TRandomAccessSectionBase& src) : m_count(src.m_count), m_start_iter(src.m_start_iter), m_start_ptr(src.m_start_ptr) {}
+				TRandomAccessSectionBase(const _TRAIterator& start_iter, size_type count) : m_count(count), m_start_iter(start_iter)
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 				template <typename _TRALoneParam>
 				TRandomAccessSectionBase(const _TRALoneParam& param)
-					: m_count(s_count_from_lone_param(param)), m_start_iter(s_xscope_iter_from_lone_param(param)) {}
+					: m_count(s_count_from_lone_param(param)), m_start_iter(s_xscope_iter_from_lone_param(param))
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 				template <typename _TRALoneParam>
 				TRandomAccessSectionBase(_TRALoneParam&& param)
-					: m_count(s_count_from_lone_param(param)), m_start_iter(s_xscope_iter_from_lone_param(std::forward<decltype(param)>(param))) {}
+					: m_count(s_count_from_lone_param(param)), m_start_iter(s_xscope_iter_from_lone_param(std::forward<decltype(param)>(param)))
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 				/* The presence of this constructor for native arrays should not be construed as condoning the use of native arrays. */
 				template<size_t Tn>
-				TRandomAccessSectionBase(value_type(&native_array)[Tn]) : m_count(Tn), m_start_iter(native_array) {}
+				TRandomAccessSectionBase(value_type(&native_array)[Tn]) : m_count(Tn), m_start_iter(native_array)
+					, m_start_ptr(s_start_ptr(has_stable_contiguous_elements_t(), m_start_iter, m_count)) {}
 
 				reference operator[](size_type _P) const {
 					if (m_count <= _P) { MSE_THROW(msearray_range_error("out of bounds index - reference operator[](size_type _P) - TRandomAccessSectionBase")); }
-					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
+					return element_at(has_stable_contiguous_elements_t(), _P);
 				}
 				reference at(size_type _P) const {
 					return (*this)[_P];
@@ -5573,6 +5835,7 @@ namespace mse {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_prefix() - TRandomAccessSectionBase")); }
 					m_count -= n;
 					m_start_iter += n;
+					s_advance_start_ptr(has_stable_contiguous_elements_t(), m_start_ptr, n);
 				}
 				void remove_suffix(size_type n) /*_NOEXCEPT*/ {
 					if (n > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void remove_suffix() - TRandomAccessSectionBase")); }
@@ -5755,6 +6018,57 @@ namespace mse {
 					return (!empty()) && (back() == c);
 				}
 
+				/* Bulk operations. The bounds are checked once per call rather than on each element access. And when the
+				iterator type ensures that the (contiguous) elements stay put, the operations work directly on raw pointers
+				(and copies of trivially copyable elements are done with memmove()). */
+				void fill(const value_type& value) const {
+					if (0 == (*this).size()) {
+						return;
+					}
+					mse::impl::ra_section_bulk_op_helpers::fill(bulk_op_first(), (*this).size(), value);
+				}
+				/* Copies the elements of the given section (or container) into the beginning of this section. The source may
+				overlap this section. */
+				template<typename _TRAParam>
+				void copy_from(const _TRAParam& ra_param) const {
+					auto sv = mse::make_xscope_random_access_const_section(mse::rsv::as_an_fparam(ra_param));
+					if (sv.size() > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void copy_from() const - TRandomAccessSectionBase")); }
+					if (0 == sv.size()) {
+						return;
+					}
+					mse::impl::ra_section_bulk_op_helpers::copy(bulk_op_first(), sv.bulk_op_first(), sv.size());
+				}
+				/* Assigns the result of the given function applied to each element of the given section (or container) to the
+				corresponding element at the beginning of this section. The source may overlap this section. */
+				template<typename _TRAParam, typename _Fn>
+				void transform(const _TRAParam& ra_param, _Fn func) const {
+					auto sv = mse::make_xscope_random_access_const_section(mse::rsv::as_an_fparam(ra_param));
+					if (sv.size() > (*this).size()) { MSE_THROW(msearray_range_error("out of bounds index - void transform() const - TRandomAccessSectionBase")); }
+					if (0 == sv.size()) {
+						return;
+					}
+					mse::impl::ra_section_bulk_op_helpers::transform(bulk_op_first(), sv.bulk_op_first(), sv.size(), func);
+				}
+				template<typename _Ty2, typename _Fn = std::plus<> >
+				_Ty2 reduce(_Ty2 init, _Fn func = _Fn()) const {
+					if (0 == (*this).size()) {
+						return init;
+					}
+					return mse::impl::ra_section_bulk_op_helpers::reduce(bulk_op_first(), (*this).size(), std::move(init), func);
+				}
+				template<typename _TRAParam>
+				int compare(const _TRAParam& ra_param) const {
+					auto sv = mse::make_xscope_random_access_const_section(mse::rsv::as_an_fparam(ra_param));
+					auto common_count = std::min(mse::msear_as_a_size_t((*this).size()), mse::msear_as_a_size_t(sv.size()));
+					if (0 != common_count) {
+						auto retval = mse::impl::ra_section_bulk_op_helpers::compare(bulk_op_first(), sv.bulk_op_first(), common_count);
+						if (0 != retval) {
+							return retval;
+						}
+					}
+					return ((*this).size() < sv.size()) ? -1 : (((*this).size() > sv.size()) ? 1 : 0);
+				}
+
 				typedef typename std::conditional<mse::impl::is_instantiation_of<_TRAIterator, mse::TXScopeCSSSStrongRAIterator>::value
 					|| mse::impl::is_instantiation_of<_TRAIterator, mse::TXScopeCSSSStrongRASectionIterator>::value
 					, TXScopeCSSSStrongRASectionIterator<_TRAIterator>, TXScopeRASectionIterator<_TRAIterator> >::type xscope_iterator_base;
@@ -5833,8 +6147,54 @@ namespace mse {
 
 				MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
+				/* When the iterator type ensures that the (contiguous) elements stay put for as long as the iterator exists
+				(i.e. it holds a strong reference to a container that is either of static structure or "structure locked"),
+				the section also holds a raw pointer to its first element. The extent of the section is verified once, at
+				construction, and elements are subsequently accessed directly through the raw pointer. */
+				typedef typename mse::impl::has_stable_contiguous_elements_strong_iterator_msemsearray<_TRAIterator>::type has_stable_contiguous_elements_t;
+				typedef typename std::conditional<has_stable_contiguous_elements_t::value
+					, decltype(std::addressof(std::declval<const _TRAIterator&>()[0])), mse::impl::TPlaceHolder<> >::type start_ptr_t;
+
+				static start_ptr_t s_start_ptr(std::true_type, const _TRAIterator& start_iter, size_type count) {
+					if (0 == count) {
+						return nullptr;
+					}
+					/* Verifying that the last element of the section is in bounds. */
+					start_iter[difference_type(mse::msear_as_a_size_t(count - 1))];
+					return std::addressof(start_iter[0]);
+				}
+				static start_ptr_t s_start_ptr(std::false_type, const _TRAIterator& /*start_iter*/, size_type /*count*/) {
+					return start_ptr_t();
+				}
+				static void s_advance_start_ptr(std::true_type, start_ptr_t& start_ptr_ref, size_type n) {
+					if (0 != n) {
+						start_ptr_ref += n;
+					}
+				}
+				static void s_advance_start_ptr(std::false_type, start_ptr_t& start_ptr_ref, size_type n) {}
+
+				auto element_at(std::true_type, size_type _P) const -> decltype(std::declval<const _TRAIterator&>()[0]) {
+					return m_start_ptr[_P];
+				}
+				auto element_at(std::false_type, size_type _P) const -> decltype(std::declval<const _TRAIterator&>()[0]) {
+					return m_start_iter[difference_type(mse::msear_as_a_size_t(_P))];
+				}
+
+				/* Returns the raw pointer to the first element if available, otherwise the (bounds checked) start iterator.
+				Must only be called on nonempty sections. */
+				auto bulk_op_first() const {
+					return bulk_op_first_helper1(has_stable_contiguous_elements_t());
+				}
+				start_ptr_t bulk_op_first_helper1(std::true_type) const {
+					return m_start_ptr;
+				}
+				const _TRAIterator& bulk_op_first_helper1(std::false_type) const {
+					return m_start_iter;
+				}
+
 				size_type m_count = 0;
 				_TRAIterator m_start_iter;
+				start_ptr_t m_start_ptr;
 
 				friend class mse::TXScopeRandomAccessSection<_TRAIterator>;
 				friend class mse::TRandomAccessSection<_TRAIterator>;
@@ -7492,24 +7852,34 @@ namespace mse {
 		template<typename _TList>
 		TXScopeRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
 			: m_xscope_exclusive_writelock_ptr_store(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr)) {
+			size_t total_size = 0;
+			size_t num_sections = 0;
+			for (const auto& section_size : section_sizes) {
+				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeRASectionSplitterXWP() - TXScopeRASectionSplitterXWP")); }
+				total_size += mse::msear_as_a_size_t(section_size);
+				num_sections += 1;
+			}
+			if (m_xscope_exclusive_writelock_ptr_store.xscope_ptr()->size() > total_size) {
+				num_sections += 1;
+			}
+			/* Pointers to the section objects are handed out, so the section storage must not be reallocated. */
+			m_splitter_aco_ra_sections.reserve(num_sections);
+
 			size_t cummulative_size = 0;
-			size_t count = 0;
 			auto section_begin_it = ra_iterator_t(m_xscope_exclusive_writelock_ptr_store.xscope_ptr());
 
 			for (const auto& section_size : section_sizes) {
-				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TXScopeRASectionSplitterXWP() - TXScopeRASectionSplitterXWP")); }
 				auto section_size_szt = mse::msear_as_a_size_t(section_size);
 
-				m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(section_begin_it, section_size_szt));
+				m_splitter_aco_ra_sections.emplace_back(section_begin_it, section_size_szt);
 
 				cummulative_size += section_size_szt;
 				section_begin_it += section_size_szt;
-				count += 1;
 			}
 			if (m_xscope_exclusive_writelock_ptr_store.xscope_ptr()->size() > cummulative_size) {
 				auto section_size = m_xscope_exclusive_writelock_ptr_store.xscope_ptr()->size() - cummulative_size;
 				auto section_size_szt = mse::msear_as_a_size_t(section_size);
-				m_splitter_aco_ra_section_map.emplace(count, xscope_aco_splitter_ra_section_t(section_begin_it, section_size_szt));
+				m_splitter_aco_ra_sections.emplace_back(section_begin_it, section_size_szt);
 			}
 		}
 		TXScopeRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
@@ -7520,13 +7890,13 @@ namespace mse {
 
 		typedef mse::TXScopeFixedPointer<xscope_aco_splitter_ra_section_t> aco_splitter_ra_section_xsptr_t;
 		aco_splitter_ra_section_xsptr_t xscope_ptr_to_ra_section_aco(size_t index) {
-			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_section_map.at(index));
+			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_sections.at(index));
 		}
 		aco_splitter_ra_section_xsptr_t xscope_ptr_to_first_ra_section_aco() {
-			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_section_map.at(0));
+			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_sections.at(0));
 		}
 		aco_splitter_ra_section_xsptr_t xscope_ptr_to_second_ra_section_aco() {
-			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_section_map.at(1));
+			return mse::us::unsafe_make_xscope_pointer_to(m_splitter_aco_ra_sections.at(1));
 		}
 	private:
 		TXScopeRASectionSplitterXWP(const TXScopeRASectionSplitterXWP& src) = delete;
@@ -7535,7 +7905,7 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
 		xscope_exclusive_writelock_ptr_store_t m_xscope_exclusive_writelock_ptr_store;
-		std::unordered_map<size_t, xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_section_map;
+		std::vector<xscope_aco_splitter_ra_section_t> m_splitter_aco_ra_sections;
 	};
 
 	template <typename _TExclusiveWritelockPtr>
@@ -7566,27 +7936,37 @@ namespace mse {
 		template<typename _TList>
 		TRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, const _TList& section_sizes)
 			: m_access_lease_obj(std::forward<exclusive_writelock_ptr_t>(exclusive_writelock_ptr)) {
+			size_t total_size = 0;
+			size_t num_sections = 0;
+			for (const auto& section_size : section_sizes) {
+				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TRASectionSplitterXWP() - TRASectionSplitterXWP")); }
+				total_size += mse::msear_as_a_size_t(section_size);
+				num_sections += 1;
+			}
+			if (m_access_lease_obj.cref()->size() > total_size) {
+				num_sections += 1;
+			}
+			/* References to the section objects are handed out, so the section storage must not be reallocated. */
+			m_splitter_aco_ra_sections.reserve(num_sections);
+
 			size_t cummulative_size = 0;
-			size_t count = 0;
 			//auto section_begin_it = m_access_lease_obj.cref()->begin();
 			auto section_begin_it = ra_iterator_t(std::addressof(*(m_access_lease_obj.cref())));
 
 			for (const auto& section_size : section_sizes) {
-				if (0 > section_size) { MSE_THROW(std::range_error("invalid section size - TRASectionSplitterXWP() - TRASectionSplitterXWP")); }
 				auto section_size_szt = mse::msear_as_a_size_t(section_size);
 
 				auto it1 = adjusted_ra_iterator(section_begin_it, &m_access_lease_obj);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, aco_splitter_ra_section_t(it1, section_size_szt));
+				m_splitter_aco_ra_sections.emplace_back(it1, section_size_szt);
 
 				cummulative_size += section_size_szt;
 				section_begin_it += section_size_szt;
-				count += 1;
 			}
 			if (m_access_lease_obj.cref()->size() > cummulative_size) {
 				auto section_size = m_access_lease_obj.cref()->size() - cummulative_size;
 				auto section_size_szt = mse::msear_as_a_size_t(section_size);
 				auto it1 = adjusted_ra_iterator(section_begin_it, &m_access_lease_obj);
-				auto res1 = m_splitter_aco_ra_section_map.emplace(count, aco_splitter_ra_section_t(it1, section_size_szt));
+				m_splitter_aco_ra_sections.emplace_back(it1, section_size_szt);
 			}
 		}
 		TRASectionSplitterXWP(exclusive_writelock_ptr_t&& exclusive_writelock_ptr, size_t split_index)
@@ -7597,13 +7977,13 @@ namespace mse {
 		}
 
 		const aco_splitter_ra_section_t& ra_section_aco(size_t index) const {
-			return m_splitter_aco_ra_section_map.at(index);
+			return m_splitter_aco_ra_sections.at(index);
 		}
 		const aco_splitter_ra_section_t& first_ra_section_aco() const {
-			return m_splitter_aco_ra_section_map.at(0);
+			return m_splitter_aco_ra_sections.at(0);
 		}
 		const aco_splitter_ra_section_t& second_ra_section_aco() const {
-			return m_splitter_aco_ra_section_map.at(1);
+			return m_splitter_aco_ra_sections.at(1);
 		}
 	private:
 		auto adjusted_ra_iterator(const ra_iterator_t& src_it, const access_lease_ptr_t& access_lease_ptr) const {
@@ -7620,7 +8000,7 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_NEW_AND_AMPERSAND_DECLARATION;
 
 		access_lease_t m_access_lease_obj;
-		std::unordered_map<size_t, aco_splitter_ra_section_t> m_splitter_aco_ra_section_map;
+		std::vector<aco_splitter_ra_section_t> m_splitter_aco_ra_sections;
 	};
 
 	template <typename _Ty, class _TAccessMutex = non_thread_safe_recursive_shared_timed_mutex>
@@ -3483,6 +3483,8 @@ namespace mse {
 				gnii_basic_string(const std_basic_string& _X) : base_class(_X) { /*m_debug_size = size();*/ }
 				gnii_basic_string(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X).contained_basic_string()) { /*m_debug_size = size();*/ }
 				gnii_basic_string(const _Myt& _X) : base_class(_X.contained_basic_string()) { /*m_debug_size = size();*/ }
+				gnii_basic_string(_Myt&& _X, const _A& _Al) : base_class(std::forward<decltype(_X)>(_X).contained_basic_string(), _Al) { /*m_debug_size = size();*/ }
+				gnii_basic_string(const _Myt& _X, const _A& _Al) : base_class(_X.contained_basic_string(), _Al) { /*m_debug_size = size();*/ }
 				typedef typename std_basic_string::const_iterator _It;
 				/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 				gnii_basic_string(_It _F, _It _L, const _A& _Al = _A()) : base_class(_F, _L, _Al) { /*m_debug_size = size();*/ }
@@ -3498,6 +3500,8 @@ namespace mse {
 					gnii_basic_string(const _Iter& _First, const _Iter& _Last, const _A& _Al) : base_class(_First, _Last, _Al) { /*m_debug_size = size();*/ }
 				gnii_basic_string(const _Ty* const _Ptr) : base_class(_Ptr) { /*m_debug_size = size();*/ }
 				gnii_basic_string(const _Ty* const _Ptr, const size_t _Count) : base_class(_Ptr, mse::msev_as_a_size_t(_Count)) { /*m_debug_size = size();*/ }
+				gnii_basic_string(const _Ty* const _Ptr, const _A& _Al) : base_class(_Ptr, _Al) { /*m_debug_size = size();*/ }
+				gnii_basic_string(const _Ty* const _Ptr, const size_t _Count, const _A& _Al) : base_class(_Ptr, mse::msev_as_a_size_t(_Count), _Al) { /*m_debug_size = size();*/ }
 				gnii_basic_string(const _Myt& _X, const size_type _Roff, const _A& _Al = _A()) : base_class(_X.contained_basic_string(), _Roff, npos, _Al) { /*m_debug_size = size();*/ }
 				gnii_basic_string(const _Myt& _X, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : base_class(_X.contained_basic_string(), _Roff, _Count, _Al) { /*m_debug_size = size();*/ }
 
@@ -5802,6 +5806,25 @@ namespace mse {
 	using nii_u16string = nii_basic_string<char16_t>;
 	using nii_u32string = nii_basic_string<char32_t>;
 
+#ifdef MSE_HAS_MEMORY_RESOURCE
+	namespace pmr {
+		/* Versions of the strings that use std::pmr::polymorphic_allocator<>, analogous to std::pmr::basic_string<>. */
+		template<class _Ty, class _Traits = std::char_traits<_Ty> >
+		using nii_basic_string = mse::nii_basic_string<_Ty, _Traits, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty, class _Traits = std::char_traits<_Ty> >
+		using stnii_basic_string = mse::stnii_basic_string<_Ty, _Traits, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty, class _Traits = std::char_traits<_Ty> >
+		using mtnii_basic_string = mse::mtnii_basic_string<_Ty, _Traits, std::pmr::polymorphic_allocator<_Ty> >;
+
+		using nii_string = nii_basic_string<char>;
+		using nii_wstring = nii_basic_string<wchar_t>;
+		using nii_u16string = nii_basic_string<char16_t>;
+		using nii_u32string = nii_basic_string<char32_t>;
+		using stnii_string = stnii_basic_string<char>;
+		using mtnii_string = mtnii_basic_string<char>;
+	}
+#endif // MSE_HAS_MEMORY_RESOURCE
+
 	inline namespace literals {
 		inline namespace string_literals {
 			inline nii_basic_string<char> operator "" _niis(const char *z_str, size_t z_len) _NOEXCEPT {
@@ -5876,6 +5899,8 @@ namespace mse {
 			msebasic_string(const base_class& _X) : base_class(_X), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X)), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(const _Myt& _X) : base_class(_X), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msebasic_string(_Myt&& _X, const _A& _Al) : base_class(std::forward<base_class>(_X), _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msebasic_string(const _Myt& _X, const _A& _Al) : base_class(_X, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			typedef typename base_class::const_iterator _It;
 			/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 			msebasic_string(_It _F, _It _L, const _A& _Al = _A()) : base_class(_F, _L, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
@@ -5891,6 +5916,8 @@ namespace mse {
 				msebasic_string(const _Iter& _First, const _Iter& _Last, const _A& _Al) : base_class(_First, _Last, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(const _Ty* const _Ptr) : base_class(_Ptr), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(const _Ty* const _Ptr, const size_t _Count) : base_class(_Ptr, _Count), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msebasic_string(const _Ty* const _Ptr, const _A& _Al) : base_class(_Ptr, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msebasic_string(const _Ty* const _Ptr, const size_t _Count, const _A& _Al) : base_class(_Ptr, _Count, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(const _Myt& _X, const size_type _Roff, const _A& _Al = _A()) : base_class(_X, _Roff, npos, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msebasic_string(const _Myt& _X, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : base_class(_X, _Roff, _Count, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 
@@ -7045,6 +7072,13 @@ namespace mse {
 				friend class mm_iterator_set_type;
 			};
 
+			/* The (shared) iterator states and handles are allocated with (a rebound copy of) the string's allocator. */
+			template<typename _TItem, typename ..._TArgs>
+			static std::shared_ptr<_TItem> s_allocate_shared_with(const _A& _Al, _TArgs&&... args) {
+				typedef typename std::allocator_traits<_A>::template rebind_alloc<_TItem> item_allocator_type;
+				return std::allocate_shared<_TItem>(item_allocator_type(_Al), std::forward<_TArgs>(args)...);
+			}
+
 			class mm_iterator_set_type {
 			public:
 				class CMMConstIterators : public std::unordered_map<CHashKey1, std::shared_ptr<mm_const_iterator_type>> {};
@@ -7154,7 +7188,7 @@ namespace mse {
 
 				mm_const_iterator_handle_type allocate_new_const_item_pointer() {
 					//auto shptr = std::shared_ptr<mm_const_iterator_type>(new mm_const_iterator_type(*m_owner_ptr));
-					auto shptr = std::make_shared<mm_const_iterator_type>(*m_owner_ptr);
+					auto shptr = s_allocate_shared_with<mm_const_iterator_type>(m_owner_ptr->get_allocator(), *m_owner_ptr);
 					auto key = m_next_available_key; m_next_available_key++;
 					mm_const_iterator_handle_type retval(key, shptr);
 					typename CMMConstIterators::value_type new_item(key, shptr);
@@ -7215,7 +7249,7 @@ namespace mse {
 
 				mm_iterator_handle_type allocate_new_item_pointer() {
 					//auto shptr = std::shared_ptr<mm_iterator_type>(new mm_iterator_type(*m_owner_ptr));
-					auto shptr = std::make_shared<mm_iterator_type>(*m_owner_ptr);
+					auto shptr = s_allocate_shared_with<mm_iterator_type>(m_owner_ptr->get_allocator(), *m_owner_ptr);
 					auto key = m_next_available_key; m_next_available_key++;
 					mm_iterator_handle_type retval(key, shptr);
 					typename CMMIterators::value_type new_item(key, shptr);
@@ -7366,11 +7400,11 @@ namespace mse {
 
 				cipointer(const _Myt& owner_cref) : m_owner_cptr(&owner_cref) {
 					mm_const_iterator_handle_type handle = m_owner_cptr->allocate_new_const_item_pointer();
-					m_handle_shptr = std::make_shared<mm_const_iterator_handle_type>(handle);
+					m_handle_shptr = s_allocate_shared_with<mm_const_iterator_handle_type>(m_owner_cptr->get_allocator(), handle);
 				}
 				cipointer(const cipointer& src_cref) : m_owner_cptr(src_cref.m_owner_cptr) {
 					mm_const_iterator_handle_type handle = m_owner_cptr->allocate_new_const_item_pointer();
-					m_handle_shptr = std::make_shared<mm_const_iterator_handle_type>(handle);
+					m_handle_shptr = s_allocate_shared_with<mm_const_iterator_handle_type>(m_owner_cptr->get_allocator(), handle);
 					const_item_pointer() = src_cref.const_item_pointer();
 				}
 				~cipointer() {
@@ -7438,11 +7472,11 @@ namespace mse {
 
 				ipointer(_Myt& owner_ref) : m_owner_ptr(&owner_ref) {
 					mm_iterator_handle_type handle = m_owner_ptr->allocate_new_item_pointer();
-					m_handle_shptr = std::make_shared<mm_iterator_handle_type>(handle);
+					m_handle_shptr = s_allocate_shared_with<mm_iterator_handle_type>(m_owner_ptr->get_allocator(), handle);
 				}
 				ipointer(const ipointer& src_cref) : m_owner_ptr(src_cref.m_owner_ptr) {
 					mm_iterator_handle_type handle = m_owner_ptr->allocate_new_item_pointer();
-					m_handle_shptr = std::make_shared<mm_iterator_handle_type>(handle);
+					m_handle_shptr = s_allocate_shared_with<mm_iterator_handle_type>(m_owner_ptr->get_allocator(), handle);
 					item_pointer() = src_cref.item_pointer();
 				}
 				~ipointer() {
@@ -32,6 +32,7 @@
 
 #include "msemsearray.h"
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <unordered_map>
@@ -39,6 +40,12 @@
 #include <climits>       // ULONG_MAX
 #include <stdexcept>
 #include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#ifdef _MSC_VER
+#include <malloc.h>	// _expand()
+#endif // _MSC_VER
 
 #ifdef MSE_SAFER_SUBSTITUTES_DISABLED
 #define MSE_MSTDVECTOR_DISABLED
@@ -218,6 +225,64 @@ namespace mse {
 	}
 
 
+	/* is_trivially_relocatable<> indicates whether an object can be moved to a new address by just copying its bytes
+	(and then discarding the original without calling its destructor). The library's vectors use it, when growing, to
+	relocate their elements with memcpy() (or the allocator's reallocate(), if present) rather than moving them one at a
+	time. It may be specialized for user-defined types. Types whose objects keep track of their own address (such as
+	mse::TRegisteredObj<>) must not be specialized as trivially relocatable. */
+	template<typename _Ty>
+	struct is_trivially_relocatable : std::is_trivially_copyable<_Ty> {};
+
+	/* realloc_allocator<> is a (stateless) allocator that obtains its storage from std::malloc(). In addition to the
+	standard allocator members, it provides the (optional) reallocate() member, and on platforms that support extending
+	an allocation in place (currently just MSVC), the (optional) try_expand() member, that the library's vectors will use
+	when present. So for example, mse::nii_vector<int, mse::realloc_allocator<int> > can grow its storage with
+	std::realloc() instead of always allocating new storage and moving the elements. */
+	template<typename _Ty>
+	class realloc_allocator {
+	public:
+		typedef _Ty value_type;
+
+		realloc_allocator() _NOEXCEPT {}
+		template<typename _Ty2>
+		realloc_allocator(const realloc_allocator<_Ty2>&) _NOEXCEPT {}
+
+		_Ty* allocate(size_t n) {
+			return checked_result(std::malloc(size_in_bytes(n)));
+		}
+		void deallocate(_Ty* p, size_t) _NOEXCEPT { std::free(p); }
+#ifdef _MSC_VER
+		/* Attempts to extend the given allocation to accommodate new_n elements without moving it. Other platforms have
+		no (documented) way to extend an allocation in place, so there this member is omitted (rather than always
+		failing) and the vectors go straight to reallocate(). */
+		bool try_expand(_Ty* p, size_t /*n*/, size_t new_n) _NOEXCEPT {
+			if (((std::numeric_limits<size_t>::max)() / sizeof(_Ty)) < new_n) { return false; }
+			return (nullptr != _expand(p, new_n * sizeof(_Ty)));
+		}
+#endif // _MSC_VER
+		/* Resizes the given allocation, moving it (bytewise) if necessary. Only suitable for trivially relocatable types. */
+		_Ty* reallocate(_Ty* p, size_t /*n*/, size_t new_n) {
+			return checked_result(std::realloc(p, size_in_bytes(new_n)));
+		}
+
+		template<typename _Ty2>
+		bool operator==(const realloc_allocator<_Ty2>&) const _NOEXCEPT { return true; }
+		template<typename _Ty2>
+		bool operator!=(const realloc_allocator<_Ty2>&) const _NOEXCEPT { return false; }
+
+	private:
+		static size_t size_in_bytes(size_t n) {
+			static_assert(alignof(_Ty) <= alignof(std::max_align_t), "realloc_allocator<> does not support over-aligned types");
+			if (((std::numeric_limits<size_t>::max)() / sizeof(_Ty)) < n) { MSE_THROW(std::bad_alloc()); }
+			/* std::malloc(0) may return a null pointer, so we always request at least one byte. */
+			return (0 == n) ? 1 : n * sizeof(_Ty);
+		}
+		static _Ty* checked_result(void* p) {
+			if (!p) { MSE_THROW(std::bad_alloc()); }
+			return static_cast<_Ty*>(p);
+		}
+	};
+
 	namespace impl {
 		namespace ns_gnii_vector {
 			template<typename _TVector>
@@ -227,7 +292,35 @@ namespace mse {
 
 	namespace us {
 		namespace impl {
-			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type>
+			namespace ns_gnii_vector {
+				template<class _Ty, size_t _N, class _A = std::allocator<_Ty> >
+				class small_vector;
+
+				/* Detect the optional allocator members try_expand(p, n, new_n) and reallocate(p, n, new_n) (see
+				mse::realloc_allocator<>). */
+				template<typename _TAlloc, typename = void>
+				struct has_try_expand : std::false_type {};
+				template<typename _TAlloc>
+				struct has_try_expand<_TAlloc, mse::impl::void_t<decltype(bool(std::declval<_TAlloc&>().try_expand(
+					std::declval<typename std::allocator_traits<_TAlloc>::pointer>(), size_t(1), size_t(1))))> > : std::true_type {};
+				template<typename _TAlloc, typename = void>
+				struct has_reallocate : std::false_type {};
+				template<typename _TAlloc>
+				struct has_reallocate<_TAlloc, mse::impl::void_t<typename std::enable_if<std::is_same<typename std::allocator_traits<_TAlloc>::pointer,
+					decltype(std::declval<_TAlloc&>().reallocate(std::declval<typename std::allocator_traits<_TAlloc>::pointer>(), size_t(1), size_t(1)))>::value>::type> > : std::true_type {};
+
+				/* When the allocator supports growing an allocation in place (or reallocating it), the vectors use small_vector<>
+				(with no inline storage), which takes advantage of it, as their underlying vector. Otherwise they use std::vector<>. */
+				template<class _Ty, class _A>
+				using default_underlying_vector_t = typename std::conditional<has_try_expand<_A>::value || has_reallocate<_A>::value
+					, small_vector<_Ty, 0, _A>, std::vector<_Ty, _A> >::type;
+			}
+		}
+	}
+
+	namespace us {
+		namespace impl {
+			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, class _TUnderlyingVector = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A> >
 			class gnii_vector;
 		}
 	}
@@ -235,6 +328,11 @@ namespace mse {
 	template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex>
 	using nii_vector = mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex>;
 
+	/* nii_small_vector<> is a version of nii_vector<> that stores up to _N elements inline, only allocating heap
+	storage once its size exceeds _N. */
+	template<class _Ty, size_t _N, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex>
+	using nii_small_vector = mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, mse::us::impl::ns_gnii_vector::small_vector<_Ty, _N, _A> >;
+
 	namespace us {
 		template<class _Ty, class _A/* = std::allocator<_Ty>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/>
 		class msevector;
@@ -258,14 +356,14 @@ namespace mse {
 	}
 
 	//template<class _Ty> auto make_xscope_structure_lock_guard(const _Ty& owner_ptr);
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
-	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >& owner_ptr)->mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >;
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >& owner_ptr)->mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >;
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
-	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >& owner_ptr)->mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >;
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >& owner_ptr)->mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >;
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TAccessMutex/* = mse::non_thread_safe_shared_mutex*/>
-	auto make_xscope_structure_lock_guard(const mse::TAccessControlledConstPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>, _TAccessMutex>& owner_ptr)->mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>, _TAccessMutex>;
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector, class _TAccessMutex/* = mse::non_thread_safe_shared_mutex*/>
+	auto make_xscope_structure_lock_guard(const mse::TAccessControlledConstPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>, _TAccessMutex>& owner_ptr)->mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>, _TAccessMutex>;
 
 	namespace us {
 		namespace impl {
@@ -1220,6 +1318,398 @@ namespace mse {
 		}
 	}
 
+	namespace us {
+		namespace impl {
+			namespace ns_gnii_vector {
+				/* Tsmall_vector_iterator<> is a thin (unchecked) iterator wrapping a pointer. It is used as the iterator of
+				small_vector<> (rather than a raw pointer) so that, as with std::vector<>, the iterators are distinct types. */
+				template<typename _TPointer>
+				class Tsmall_vector_iterator {
+				public:
+					typedef std::random_access_iterator_tag iterator_category;
+					typedef typename std::iterator_traits<_TPointer>::value_type value_type;
+					typedef typename std::iterator_traits<_TPointer>::difference_type difference_type;
+					typedef _TPointer pointer;
+					typedef typename std::iterator_traits<_TPointer>::reference reference;
+
+					Tsmall_vector_iterator() {}
+					explicit Tsmall_vector_iterator(_TPointer ptr) : m_ptr(ptr) {}
+					template<typename _TPointer2, class = typename std::enable_if<(!std::is_same<_TPointer2, _TPointer>::value) && (std::is_convertible<_TPointer2, _TPointer>::value), void>::type>
+					Tsmall_vector_iterator(const Tsmall_vector_iterator<_TPointer2>& src) : m_ptr(src.base()) {}
+
+					reference operator*() const { return *m_ptr; }
+					pointer operator->() const { return m_ptr; }
+					reference operator[](difference_type _Off) const { return m_ptr[_Off]; }
+					Tsmall_vector_iterator& operator++() { ++m_ptr; return (*this); }
+					Tsmall_vector_iterator operator++(int) { auto retval = (*this); ++m_ptr; return retval; }
+					Tsmall_vector_iterator& operator--() { --m_ptr; return (*this); }
+					Tsmall_vector_iterator operator--(int) { auto retval = (*this); --m_ptr; return retval; }
+					Tsmall_vector_iterator& operator+=(difference_type n) { m_ptr += n; return (*this); }
+					Tsmall_vector_iterator& operator-=(difference_type n) { m_ptr -= n; return (*this); }
+					Tsmall_vector_iterator operator+(difference_type n) const { return Tsmall_vector_iterator(m_ptr + n); }
+					Tsmall_vector_iterator operator-(difference_type n) const { return Tsmall_vector_iterator(m_ptr - n); }
+					friend Tsmall_vector_iterator operator+(difference_type n, const Tsmall_vector_iterator& _Right_cref) { return _Right_cref + n; }
+					template<typename _TPointer2>
+					difference_type operator-(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return m_ptr - _Right_cref.base(); }
+					template<typename _TPointer2>
+					bool operator==(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr == _Right_cref.base()); }
+					template<typename _TPointer2>
+					bool operator!=(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr != _Right_cref.base()); }
+					template<typename _TPointer2>
+					bool operator<(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr < _Right_cref.base()); }
+					template<typename _TPointer2>
+					bool operator<=(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr <= _Right_cref.base()); }
+					template<typename _TPointer2>
+					bool operator>(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr > _Right_cref.base()); }
+					template<typename _TPointer2>
+					bool operator>=(const Tsmall_vector_iterator<_TPointer2>& _Right_cref) const { return (m_ptr >= _Right_cref.base()); }
+					_TPointer base() const { return m_ptr; }
+
+				private:
+					_TPointer m_ptr = nullptr;
+				};
+
+				/* small_vector<> is an (unprotected) vector with the same interface as std::vector<> that stores up to _N
+				elements inline (within the object itself), and only allocates heap storage when its size exceeds _N. It is
+				intended to be used as the underlying vector of nii_small_vector<> and stnii_small_vector<>, which provide the
+				safety. Note that, unlike std::vector<>, moving or swapping a small_vector<> whose elements are stored inline
+				moves the individual elements (and so invalidates references to them).
+				When growing, small_vector<> first tries to extend its heap storage in place using the allocator's try_expand()
+				member (if present). Failing that, trivially relocatable elements (see mse::is_trivially_relocatable<>) are
+				relocated using the allocator's reallocate() member (if present) or memcpy(). A small_vector<> with an inline
+				capacity of zero is used as the underlying vector of the library's vectors when the allocator provides those
+				members. */
+				template<class _Ty, size_t _N, class _A/* = std::allocator<_Ty>*/>
+				class small_vector {
+				public:
+					typedef _Ty value_type;
+					typedef _A allocator_type;
+					typedef size_t size_type;
+					typedef std::ptrdiff_t difference_type;
+					typedef _Ty& reference;
+					typedef const _Ty& const_reference;
+					typedef _Ty* pointer;
+					typedef const _Ty* const_pointer;
+					typedef Tsmall_vector_iterator<_Ty*> iterator;
+					typedef Tsmall_vector_iterator<const _Ty*> const_iterator;
+					typedef std::reverse_iterator<iterator> reverse_iterator;
+					typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+					explicit small_vector(const _A& _Al = _A()) : m_allocator(_Al) {}
+					explicit small_vector(size_type count, const _A& _Al = _A()) : m_allocator(_Al) { resize(count); }
+					small_vector(size_type count, const _Ty& _X, const _A& _Al = _A()) : m_allocator(_Al) { assign(count, _X); }
+					template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+					small_vector(const _Iter& _First, const _Iter& _Last, const _A& _Al = _A()) : m_allocator(_Al) { append(_First, _Last); }
+					small_vector(std::initializer_list<_Ty> _Ilist, const _A& _Al = _A()) : m_allocator(_Al) { append(_Ilist.begin(), _Ilist.end()); }
+					small_vector(const small_vector& src) : m_allocator(alloc_traits::select_on_container_copy_construction(src.m_allocator)) {
+						append(src.begin(), src.end());
+					}
+					small_vector(const small_vector& src, const _A& _Al) : m_allocator(_Al) { append(src.begin(), src.end()); }
+					small_vector(small_vector&& src) : m_allocator(std::move(src.m_allocator)) { take_contents_of(src); }
+					small_vector(small_vector&& src, const _A& _Al) : m_allocator(_Al) { take_contents_of(src); }
+					~small_vector() {
+						clear();
+						release_heap_storage();
+					}
+
+					small_vector& operator=(const small_vector& src) {
+						if (std::addressof(src) != this) { assign(src.begin(), src.end()); }
+						return (*this);
+					}
+					small_vector& operator=(small_vector&& src) {
+						if (std::addressof(src) != this) {
+							clear();
+							release_heap_storage();
+							take_contents_of(src);
+						}
+						return (*this);
+					}
+					small_vector& operator=(std::initializer_list<_Ty> _Ilist) { assign(_Ilist.begin(), _Ilist.end()); return (*this); }
+
+					size_type size() const _NOEXCEPT { return m_size; }
+					size_type capacity() const _NOEXCEPT { return m_capacity; }
+					size_type max_size() const _NOEXCEPT { return alloc_traits::max_size(m_allocator); }
+					bool empty() const _NOEXCEPT { return (0 == m_size); }
+					_A get_allocator() const _NOEXCEPT { return m_allocator; }
+					/* Returns true if the elements are currently stored inline. */
+					bool is_inline() const _NOEXCEPT { return (inline_data() == m_data); }
+
+					pointer data() _NOEXCEPT { return m_data; }
+					const_pointer data() const _NOEXCEPT { return m_data; }
+					reference operator[](size_type _P) { return m_data[_P]; }
+					const_reference operator[](size_type _P) const { return m_data[_P]; }
+					reference at(size_type _P) {
+						if (m_size <= _P) { MSE_THROW(std::out_of_range("index out of range - reference at() - small_vector")); }
+						return m_data[_P];
+					}
+					const_reference at(size_type _P) const {
+						if (m_size <= _P) { MSE_THROW(std::out_of_range("index out of range - const_reference at() - small_vector")); }
+						return m_data[_P];
+					}
+					reference front() { return m_data[0]; }
+					const_reference front() const { return m_data[0]; }
+					reference back() { return m_data[m_size - 1]; }
+					const_reference back() const { return m_data[m_size - 1]; }
+
+					iterator begin() _NOEXCEPT { return iterator(m_data); }
+					const_iterator begin() const _NOEXCEPT { return const_iterator(m_data); }
+					iterator end() _NOEXCEPT { return iterator(m_data + m_size); }
+					const_iterator end() const _NOEXCEPT { return const_iterator(m_data + m_size); }
+					const_iterator cbegin() const _NOEXCEPT { return begin(); }
+					const_iterator cend() const _NOEXCEPT { return end(); }
+					reverse_iterator rbegin() _NOEXCEPT { return reverse_iterator(end()); }
+					const_reverse_iterator rbegin() const _NOEXCEPT { return const_reverse_iterator(end()); }
+					reverse_iterator rend() _NOEXCEPT { return reverse_iterator(begin()); }
+					const_reverse_iterator rend() const _NOEXCEPT { return const_reverse_iterator(begin()); }
+					const_reverse_iterator crbegin() const _NOEXCEPT { return rbegin(); }
+					const_reverse_iterator crend() const _NOEXCEPT { return rend(); }
+
+					void reserve(size_type _Count) {
+						if (max_size() < _Count) { MSE_THROW(std::length_error("requested capacity too large - void reserve() - small_vector")); }
+						if (m_capacity < _Count) { relocate_to_new_storage(_Count); }
+					}
+					void shrink_to_fit() {
+						if (!is_inline()) {
+							relocate_to_new_storage((_N >= m_size) ? size_type(_N) : m_size);
+						}
+					}
+					void resize(size_type _Count) {
+						if (m_size > _Count) { destroy_tail(m_size - _Count); }
+						else {
+							reserve_for_additional(_Count - m_size);
+							while (m_size < _Count) { emplace_back(); }
+						}
+					}
+					void resize(size_type _Count, const _Ty& _X) {
+						if (m_size > _Count) { destroy_tail(m_size - _Count); }
+						else if (m_size < _Count) {
+							/* _X might be an element of this vector. */
+							_Ty value(_X);
+							reserve_for_additional(_Count - m_size);
+							while (m_size < _Count) { push_back(value); }
+						}
+					}
+					void clear() _NOEXCEPT { destroy_tail(m_size); }
+
+					void push_back(const _Ty& _X) { emplace_back(_X); }
+					void push_back(_Ty&& _X) { emplace_back(std::move(_X)); }
+					template<class ..._Valty>
+					reference emplace_back(_Valty&& ..._Val) {
+						if (m_capacity == m_size) {
+							/* The arguments might refer to elements of this vector, so the new element is constructed before relocating. */
+							_Ty value(std::forward<_Valty>(_Val)...);
+							relocate_to_new_storage(grown_capacity(m_size + 1));
+							alloc_traits::construct(m_allocator, m_data + m_size, std::move(value));
+						}
+						else {
+							alloc_traits::construct(m_allocator, m_data + m_size, std::forward<_Valty>(_Val)...);
+						}
+						m_size += 1;
+						return back();
+					}
+					void pop_back() {
+						if (0 == m_size) { MSE_THROW(gnii_vector_range_error("pop_back() on empty - void pop_back() - small_vector")); }
+						destroy_tail(1);
+					}
+
+					void assign(size_type _Count, const _Ty& _X) {
+						_Ty value(_X);
+						clear();
+						reserve(_Count);
+						while (m_size < _Count) { push_back(value); }
+					}
+					template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+					void assign(const _Iter& _First, const _Iter& _Last) {
+						clear();
+						append(_First, _Last);
+					}
+					void assign(std::initializer_list<_Ty> _Ilist) { assign(_Ilist.begin(), _Ilist.end()); }
+
+					/* Insertions are implemented by appending the new elements and rotating them into place. */
+					template<class ..._Valty>
+					iterator emplace(const_iterator _Where, _Valty&& ..._Val) {
+						const auto index = size_type(_Where - cbegin());
+						emplace_back(std::forward<_Valty>(_Val)...);
+						std::rotate(begin() + index, end() - 1, end());
+						return begin() + index;
+					}
+					iterator insert(const_iterator _Where, const _Ty& _X) { return emplace(_Where, _X); }
+					iterator insert(const_iterator _Where, _Ty&& _X) { return emplace(_Where, std::move(_X)); }
+					iterator insert(const_iterator _Where, size_type _Count, const _Ty& _X) {
+						const auto index = size_type(_Where - cbegin());
+						const auto original_size = m_size;
+						_Ty value(_X);
+						reserve_for_additional(_Count);
+						while (m_size < original_size + _Count) { push_back(value); }
+						std::rotate(begin() + index, begin() + original_size, end());
+						return begin() + index;
+					}
+					template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+					iterator insert(const_iterator _Where, const _Iter& _First, const _Iter& _Last) {
+						const auto index = size_type(_Where - cbegin());
+						const auto original_size = m_size;
+						append(_First, _Last);
+						std::rotate(begin() + index, begin() + original_size, end());
+						return begin() + index;
+					}
+					iterator insert(const_iterator _Where, std::initializer_list<_Ty> _Ilist) { return insert(_Where, _Ilist.begin(), _Ilist.end()); }
+					iterator erase(const_iterator _Where) { return erase(_Where, _Where + 1); }
+					iterator erase(const_iterator _First, const_iterator _Last) {
+						const auto first_index = size_type(_First - cbegin());
+						const auto last_index = size_type(_Last - cbegin());
+						if (first_index == last_index) { return begin() + first_index; }
+						std::move(begin() + last_index, end(), begin() + first_index);
+						destroy_tail(last_index - first_index);
+						return begin() + first_index;
+					}
+
+					void swap(small_vector& _Other) {
+						if ((!is_inline()) && (!_Other.is_inline()) && (m_allocator == _Other.m_allocator)) {
+							std::swap(m_data, _Other.m_data);
+							std::swap(m_size, _Other.m_size);
+							std::swap(m_capacity, _Other.m_capacity);
+						}
+						else if (std::addressof(_Other) != this) {
+							small_vector tmp(std::move(_Other));
+							_Other = std::move(*this);
+							(*this) = std::move(tmp);
+						}
+					}
+
+					friend bool operator==(const small_vector& _Left, const small_vector& _Right) {
+						return (_Left.size() == _Right.size()) && std::equal(_Left.begin(), _Left.end(), _Right.begin());
+					}
+					friend bool operator!=(const small_vector& _Left, const small_vector& _Right) { return !(_Left == _Right); }
+					friend bool operator<(const small_vector& _Left, const small_vector& _Right) {
+						return std::lexicographical_compare(_Left.begin(), _Left.end(), _Right.begin(), _Right.end());
+					}
+					friend bool operator>(const small_vector& _Left, const small_vector& _Right) { return (_Right < _Left); }
+					friend bool operator<=(const small_vector& _Left, const small_vector& _Right) { return !(_Right < _Left); }
+					friend bool operator>=(const small_vector& _Left, const small_vector& _Right) { return !(_Left < _Right); }
+
+				private:
+					typedef std::allocator_traits<_A> alloc_traits;
+
+					/* Owns a newly allocated storage buffer (and the elements constructed in it) until released. */
+					class CNewStorageGuard {
+					public:
+						CNewStorageGuard(small_vector& owner_ref, pointer data, size_type capacity) : m_owner_ref(owner_ref), m_data(data), m_capacity(capacity) {}
+						~CNewStorageGuard() {
+							if (m_data) {
+								for (size_type i = 0; i < m_num_constructed; i += 1) { alloc_traits::destroy(m_owner_ref.m_allocator, m_data + i); }
+								if (m_owner_ref.inline_data() != m_data) { alloc_traits::deallocate(m_owner_ref.m_allocator, m_data, m_capacity); }
+							}
+						}
+						void release() { m_data = nullptr; }
+
+						small_vector& m_owner_ref;
+						pointer m_data = nullptr;
+						size_type m_capacity = 0;
+						size_type m_num_constructed = 0;
+					};
+
+					pointer inline_data() _NOEXCEPT { return reinterpret_cast<pointer>(std::addressof(m_inline_storage)); }
+					const_pointer inline_data() const _NOEXCEPT { return reinterpret_cast<const_pointer>(std::addressof(m_inline_storage)); }
+
+					size_type grown_capacity(size_type min_capacity) const {
+						if (max_size() < min_capacity) { MSE_THROW(std::length_error("requested capacity too large - small_vector")); }
+						const auto doubled_capacity = (max_size() / 2 >= m_capacity) ? 2 * m_capacity : max_size();
+						return (doubled_capacity >= min_capacity) ? doubled_capacity : min_capacity;
+					}
+					void reserve_for_additional(size_type count) {
+						if (m_capacity - m_size < count) { relocate_to_new_storage(grown_capacity(m_size + count)); }
+					}
+					/* Moves the elements into new storage of the given capacity (which must not be less than the current size).
+					If the given capacity does not exceed _N, the elements are moved into the inline storage. */
+					void relocate_to_new_storage(size_type new_capacity) {
+						assert(m_size <= new_capacity);
+						const bool to_inline = (_N >= new_capacity);
+						if (to_inline && is_inline()) { return; }
+						if ((!to_inline) && (!is_inline())) {
+							if ((m_capacity < new_capacity) && try_expand_heap_storage(has_try_expand<_A>(), new_capacity)) { return; }
+							if (reallocate_heap_storage(std::integral_constant<bool, has_reallocate<_A>::value && trivially_relocatable_type::value>(), new_capacity)) { return; }
+						}
+						auto new_data = to_inline ? inline_data() : alloc_traits::allocate(m_allocator, new_capacity);
+						relocate_elements_to(trivially_relocatable_type(), new_data, new_capacity);
+						release_heap_storage();
+						m_data = new_data;
+						m_capacity = to_inline ? size_type(_N) : new_capacity;
+					}
+					typedef std::integral_constant<bool, mse::is_trivially_relocatable<_Ty>::value> trivially_relocatable_type;
+					bool try_expand_heap_storage(std::true_type, size_type new_capacity) {
+						if (!m_allocator.try_expand(m_data, m_capacity, new_capacity)) { return false; }
+						m_capacity = new_capacity;
+						return true;
+					}
+					bool try_expand_heap_storage(std::false_type, size_type) { return false; }
+					bool reallocate_heap_storage(std::true_type, size_type new_capacity) {
+						m_data = m_allocator.reallocate(m_data, m_capacity, new_capacity);
+						m_capacity = new_capacity;
+						return true;
+					}
+					bool reallocate_heap_storage(std::false_type, size_type) { return false; }
+					/* Moves the elements into the given (uninitialized) storage. Afterwards the original element objects are
+					either destroyed or, if trivially relocatable, considered relocated. */
+					void relocate_elements_to(std::true_type, pointer new_data, size_type /*new_capacity*/) _NOEXCEPT {
+						if (0 != m_size) { std::memcpy(static_cast<void*>(new_data), static_cast<const void*>(m_data), m_size * sizeof(_Ty)); }
+					}
+					void relocate_elements_to(std::false_type, pointer new_data, size_type new_capacity) {
+						CNewStorageGuard guard(*this, new_data, new_capacity);
+						for (size_type i = 0; i < m_size; i += 1) {
+							alloc_traits::construct(m_allocator, new_data + i, std::move_if_noexcept(m_data[i]));
+							guard.m_num_constructed += 1;
+						}
+						guard.release();
+						for (size_type i = 0; i < m_size; i += 1) { alloc_traits::destroy(m_allocator, m_data + i); }
+					}
+					void release_heap_storage() _NOEXCEPT {
+						if (!is_inline()) {
+							alloc_traits::deallocate(m_allocator, m_data, m_capacity);
+							m_data = inline_data();
+							m_capacity = _N;
+						}
+					}
+					void destroy_tail(size_type count) _NOEXCEPT {
+						for (; 0 < count; count -= 1) {
+							m_size -= 1;
+							alloc_traits::destroy(m_allocator, m_data + m_size);
+						}
+					}
+					template<class _Iter>
+					void append(const _Iter& _First, const _Iter& _Last) {
+						for (auto it = _First; _Last != it; ++it) { emplace_back(*it); }
+					}
+					/* Assumes this vector is empty and using its inline storage. */
+					void take_contents_of(small_vector& src) {
+						if ((!src.is_inline()) && (m_allocator == src.m_allocator)) {
+							m_data = src.m_data;
+							m_size = src.m_size;
+							m_capacity = src.m_capacity;
+							src.m_data = src.inline_data();
+							src.m_size = 0;
+							src.m_capacity = _N;
+						}
+						else {
+							reserve(src.m_size);
+							for (size_type i = 0; i < src.m_size; i += 1) { emplace_back(std::move(src.m_data[i])); }
+							src.clear();
+						}
+					}
+
+					struct CNoInlineStorage {};
+					typedef typename std::conditional<(0 == _N), CNoInlineStorage
+						, typename std::aligned_storage<sizeof(_Ty) * ((0 == _N) ? 1 : _N), alignof(_Ty)>::type>::type inline_storage_type;
+
+					_A m_allocator;
+					inline_storage_type m_inline_storage;
+					pointer m_data = inline_data();
+					size_type m_size = 0;
+					size_type m_capacity = _N;
+				};
+			}
+		}
+	}
+
 	namespace us {
 		namespace impl {
 
@@ -1228,14 +1718,15 @@ namespace mse {
 			like ss_begin<>(...) and ss_end<>(...) which take a pointer parameter and return a (bounds-checked) iterator that
 			inherits the safety of the given pointer. mse::us::impl::gnii_vector<> also supports "scope" iterators which are safe without any
 			run-time overhead. mse::us::impl::gnii_vector<> is a data type that is eligible to be shared between asynchronous threads. */
-			template<class _Ty, class _A/* = std::allocator<_Ty>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/, template<typename> class _TTXScopeConstIterator/* = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type*/>
-			class gnii_vector : private mse::impl::TOpaqueWrapper<std::vector<_Ty, _A> >, public us::impl::ContiguousSequenceContainerTagBase, public us::impl::LockableStructureContainerTagBase {
+			template<class _Ty, class _A/* = std::allocator<_Ty>*/, class _TStateMutex/* = mse::non_thread_safe_shared_mutex*/, template<typename> class _TTXScopeConstIterator/* = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type*/, class _TUnderlyingVector/* = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A>*/>
+			class gnii_vector : private mse::impl::TOpaqueWrapper<_TUnderlyingVector>, public us::impl::ContiguousSequenceContainerTagBase, public us::impl::LockableStructureContainerTagBase {
 			public:
 				typedef _TStateMutex state_mutex_type;
 
 				/* We (privately) inherit the underlying data type rather than make it a data member to ensure it's the "first" component in the structure.*/
-				typedef mse::impl::TOpaqueWrapper<std::vector<_Ty, _A> > base_class;
-				typedef std::vector<_Ty, _A> std_vector;
+				typedef mse::impl::TOpaqueWrapper<_TUnderlyingVector> base_class;
+				/* The underlying vector is an std::vector<> unless otherwise specified (as with nii_small_vector<>). */
+				typedef _TUnderlyingVector std_vector;
 				typedef std_vector _MV;
 				typedef gnii_vector _Myt;
 
@@ -1260,7 +1751,7 @@ namespace mse {
 				const _MV& contained_vector() const& { return (*this).value(); }
 				const _MV& contained_vector() const&& { return (*this).value(); }
 				_MV& contained_vector() & { return (*this).value(); }
-				auto&& contained_vector() && { return std::forward<decltype(*this)>(*this).value(); }
+				auto&& contained_vector() && { return std::move(*this).value(); }
 
 			public:
 				explicit gnii_vector(const _A& _Al = _A())
@@ -1271,14 +1762,33 @@ namespace mse {
 					: base_class(msev_as_a_size_t(_N)) {
 					/*m_debug_size = size();*/
 				}
+				gnii_vector(size_type _N, const _A& _Al)
+					: base_class(msev_as_a_size_t(_N), _Al) {
+					/*m_debug_size = size();*/
+				}
 				explicit gnii_vector(size_type _N, const _Ty& _V, const _A& _Al = _A())
 					: base_class(msev_as_a_size_t(_N), _V, _Al) {
 					/*m_debug_size = size();*/
 				}
 				gnii_vector(std_vector&& _X) : base_class(std::forward<decltype(_X)>(_X)) { /*m_debug_size = size();*/ }
 				gnii_vector(const std_vector& _X) : base_class(_X) { /*m_debug_size = size();*/ }
-				gnii_vector(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X).contained_vector()) { /*m_debug_size = size();*/ }
+				gnii_vector(std_vector&& _X, const _A& _Al) : base_class(std::forward<decltype(_X)>(_X), _Al) { /*m_debug_size = size();*/ }
+				gnii_vector(const std_vector& _X, const _A& _Al) : base_class(_X, _Al) { /*m_debug_size = size();*/ }
+				gnii_vector(_Myt&& _X) : base_class(_X.contained_vector().get_allocator()) {
+					/* The source's contents are moved (rather than copied), so its structure must not be locked. */
+					structure_change_guard<decltype(_X.m_structure_change_mutex)> lock1(_X.m_structure_change_mutex);
+					contained_vector() = std::forward<decltype(_X)>(_X).contained_vector();
+					/*m_debug_size = size();*/
+				}
+				gnii_vector(_Myt&& _X, const _A& _Al) : base_class(_Al) {
+					/* The source's contents are moved (rather than copied), so its structure must not be locked. (If the
+					allocators differ, the elements are moved individually.) */
+					structure_change_guard<decltype(_X.m_structure_change_mutex)> lock1(_X.m_structure_change_mutex);
+					contained_vector() = std::forward<decltype(_X)>(_X).contained_vector();
+					/*m_debug_size = size();*/
+				}
 				gnii_vector(const _Myt& _X) : base_class(_X.contained_vector()) { /*m_debug_size = size();*/ }
+				gnii_vector(const _Myt& _X, const _A& _Al) : base_class(_X.contained_vector(), _Al) { /*m_debug_size = size();*/ }
 				typedef typename std_vector::const_iterator _It;
 				/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 				gnii_vector(_It _F, _It _L, const _A& _Al = _A()) : base_class(_F, _L, _Al) { /*m_debug_size = size();*/ }
@@ -1299,7 +1809,9 @@ namespace mse {
 					return (*this);
 				}
 				_Myt& operator=(_Myt&& _X) {
+					if (std::addressof(_X) == this) { return (*this); }
 					structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+					structure_change_guard<decltype(_X.m_structure_change_mutex)> lock2(_X.m_structure_change_mutex);
 					contained_vector().operator=(std::forward<decltype(_X)>(_X).contained_vector());
 					return (*this);
 				}
@@ -1445,7 +1957,7 @@ namespace mse {
 					contained_vector().swap(_Other);
 				}
 				template<typename _TStateMutex2, template<typename> class _TTXScopeConstIterator2>
-				void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2>& _Other) {	// swap contents with _Other
+				void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2, _TUnderlyingVector>& _Other) {	// swap contents with _Other
 					structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
 					contained_vector().swap(_Other.contained_vector());
 				}
@@ -2155,7 +2667,7 @@ namespace mse {
 
 				friend /*class */xscope_ss_const_iterator_type;
 				friend /*class */xscope_ss_iterator_type;
-				template<class _Ty2, class _A2, class _TStateMutex2, template<typename> class _TTXScopeConstIterator2> friend class gnii_vector;
+				template<class _Ty2, class _A2, class _TStateMutex2, template<typename> class _TTXScopeConstIterator2, class _TUnderlyingVector2> friend class gnii_vector;
 				//friend class us::msevector<_Ty, _A>;
 				template<class _Ty2, class _A2, class _TStateMutex2> friend class us::msevector;
 				friend class mse::us::impl::Txscope_structure_lock_guard<_Myt>;
@@ -2173,23 +2685,23 @@ namespace mse {
 				->gnii_vector<typename std::iterator_traits<_Iter>::value_type, _Alloc>;
 #endif /* MSE_HAS_CXX17 */
 
-			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type> inline bool operator!=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left,
-				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Right) {	// test for vector inequality
+			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, class _TUnderlyingVector = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A> > inline bool operator!=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left,
+				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Right) {	// test for vector inequality
 				return (!(_Left == _Right));
 			}
 
-			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type> inline bool operator>(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left,
-				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Right) {	// test if _Left > _Right for vectors
+			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, class _TUnderlyingVector = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A> > inline bool operator>(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left,
+				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Right) {	// test if _Left > _Right for vectors
 				return (_Right < _Left);
 			}
 
-			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type> inline bool operator<=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left,
-				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Right) {	// test if _Left <= _Right for vectors
+			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, class _TUnderlyingVector = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A> > inline bool operator<=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left,
+				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Right) {	// test if _Left <= _Right for vectors
 				return (!(_Right < _Left));
 			}
 
-			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type> inline bool operator>=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left,
-				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Right) {	// test if _Left >= _Right for vectors
+			template<class _Ty, class _A = std::allocator<_Ty>, class _TStateMutex = mse::non_thread_safe_shared_mutex, template<typename> class _TTXScopeConstIterator = mse::impl::ns_gnii_vector::Tgnii_vector_xscope_ss_const_iterator_type, class _TUnderlyingVector = mse::us::impl::ns_gnii_vector::default_underlying_vector_t<_Ty, _A> > inline bool operator>=(const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left,
+				const mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Right) {	// test if _Left >= _Right for vectors
 				return (!(_Left < _Right));
 			}
 
@@ -2269,14 +2781,14 @@ namespace mse {
 	/* While an instance of xscope_structure_lock_guard exists it ensures that direct (scope) pointers to
 	individual elements in the vector do not become invalid by preventing any operation that might resize the vector
 	or increase its capacity. Any attempt to execute such an operation would result in an exception. */
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
-	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> > {
-		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >(owner_ptr);
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> > {
+		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >(owner_ptr);
 	}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
-	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> > {
-		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator> >(owner_ptr);
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> > {
+		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector> >(owner_ptr);
 	}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 	/* Overloads for rsv::TReturnableFParam<>. */
@@ -2285,9 +2797,9 @@ namespace mse {
 	/* For objects that are access controlled under an "exclusive writer" access policy, the object is immutable
 	while a const pointer to the object exists. So given an "exclusive writer" const pointer to a vector, it is
 	safe to provide a direct scope const pointer to any of its elements. */
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TAccessMutex = mse::non_thread_safe_shared_mutex>
-	auto make_xscope_structure_lock_guard(const mse::TAccessControlledConstPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>, _TAccessMutex>& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>, _TAccessMutex> {
-		return mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>, _TAccessMutex>(owner_ptr);
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector, class _TAccessMutex = mse::non_thread_safe_shared_mutex>
+	auto make_xscope_structure_lock_guard(const mse::TAccessControlledConstPointer<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>, _TAccessMutex>& owner_ptr) -> mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>, _TAccessMutex> {
+		return mse::impl::ns_gnii_vector::xscope_ewconst_structure_lock_guard<mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>, _TAccessMutex>(owner_ptr);
 	}
 
 	template<class _TDynamicContainerPointer>
@@ -2316,13 +2828,13 @@ namespace mse {
 
 namespace std {
 
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator>
-	void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left, mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Right) _NOEXCEPT_OP(_NOEXCEPT_OP(_Left.swap(_Right)))
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector>
+	void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left, mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Right) _NOEXCEPT_OP(_NOEXCEPT_OP(_Left.swap(_Right)))
 	{
 		_Left.swap(_Right);
 	}
-	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TStateMutex2, template<typename> class _TTXScopeConstIterator2, class = typename std::enable_if<!std::is_same<_TStateMutex, _TStateMutex2>::value, void>::type>
-	void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator>& _Left, mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2>& _Right) _NOEXCEPT_OP(_NOEXCEPT_OP(_Left.swap(_Right)))
+	template<class _Ty, class _A, class _TStateMutex, template<typename> class _TTXScopeConstIterator, class _TUnderlyingVector, class _TStateMutex2, template<typename> class _TTXScopeConstIterator2, class = typename std::enable_if<!std::is_same<_TStateMutex, _TStateMutex2>::value, void>::type>
+	void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex, _TTXScopeConstIterator, _TUnderlyingVector>& _Left, mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2, _TUnderlyingVector>& _Right) _NOEXCEPT_OP(_NOEXCEPT_OP(_Left.swap(_Right)))
 	{
 		_Left.swap(_Right);
 	}
@@ -2471,6 +2983,70 @@ namespace mse {
 	}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 
+	/* stnii_small_vector<> is a version of stnii_vector<> that stores up to _N elements inline, only allocating heap
+	storage once its size exceeds _N. */
+	template<class _Ty, size_t _N, class _A = std::allocator<_Ty> >
+	class stnii_small_vector : public mse::us::impl::gnii_vector<_Ty, _A, mse::non_thread_safe_shared_mutex, mse::impl::ns_gnii_vector::Tgnii_vector_xscope_cslsstrong_const_iterator_type, mse::us::impl::ns_gnii_vector::small_vector<_Ty, _N, _A> >, public us::impl::AsyncNotShareableTagBase {
+	public:
+		typedef mse::us::impl::gnii_vector<_Ty, _A, mse::non_thread_safe_shared_mutex, mse::impl::ns_gnii_vector::Tgnii_vector_xscope_cslsstrong_const_iterator_type, mse::us::impl::ns_gnii_vector::small_vector<_Ty, _N, _A> > base_class;
+		typedef mse::non_thread_safe_shared_mutex _TStateMutex;
+
+		typedef typename base_class::allocator_type allocator_type;
+		MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(base_class);
+
+		typedef typename base_class::iterator iterator;
+		typedef typename base_class::const_iterator const_iterator;
+		typedef typename base_class::reverse_iterator reverse_iterator;
+		typedef typename base_class::const_reverse_iterator const_reverse_iterator;
+
+		template<typename _TVectorConstPointer, class = typename std::enable_if<(mse::impl::is_potentially_not_xscope<_TVectorConstPointer>::value), void>::type>
+		using Tss_const_iterator_type = typename base_class::template Tss_const_iterator_type<_TVectorConstPointer>;
+		template<typename _TVectorPointer, class = typename std::enable_if<(mse::impl::is_potentially_not_xscope<_TVectorPointer>::value), void>::type>
+		using Tss_iterator_type = typename base_class::template Tss_iterator_type<_TVectorPointer>;
+		template<typename _TVectorPointer, class = typename std::enable_if<(mse::impl::is_potentially_not_xscope<_TVectorPointer>::value), void>::type>
+		using Tss_reverse_iterator_type = typename base_class::template Tss_reverse_iterator_type<_TVectorPointer>;
+		template<typename _TVectorConstPointer, class = typename std::enable_if<(mse::impl::is_potentially_not_xscope<_TVectorConstPointer>::value), void>::type>
+		using Tss_const_reverse_iterator_type = typename base_class::template Tss_const_reverse_iterator_type<_TVectorConstPointer>;
+		typedef typename base_class::ss_iterator_type ss_iterator_type;
+		typedef typename base_class::ss_const_iterator_type ss_const_iterator_type;
+		typedef typename base_class::ss_reverse_iterator_type ss_reverse_iterator_type;
+		typedef typename base_class::ss_const_reverse_iterator_type ss_const_reverse_iterator_type;
+
+		typedef typename base_class::xscope_ss_const_iterator_type xscope_ss_const_iterator_type;
+		typedef typename base_class::xscope_ss_iterator_type xscope_ss_iterator_type;
+
+		typedef typename base_class::xscope_const_iterator xscope_const_iterator;
+		typedef typename base_class::xscope_iterator xscope_iterator;
+
+		MSE_USING(stnii_small_vector, base_class);
+
+		stnii_small_vector(_XSTD initializer_list<value_type> _Ilist, const _A& _Al = _A()) : base_class(_Ilist, _Al) {}
+	};
+
+	/* The returned xscope_structure_lock_guard constructed from a const reference is only safe because
+	stnii_small_vector<> is not eligible to be shared between threads. */
+	template<class _Ty, size_t _N, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedConstPointer<stnii_small_vector<_Ty, _N, _A> >& owner_ptr) {
+		return mse::impl::ns_stnii_vector::xscope_const_structure_lock_guard<stnii_small_vector<_Ty, _N, _A> >(owner_ptr);
+	}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template<class _Ty, size_t _N, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedConstPointer<stnii_small_vector<_Ty, _N, _A> >& owner_ptr) {
+		return mse::impl::ns_stnii_vector::xscope_const_structure_lock_guard<stnii_small_vector<_Ty, _N, _A> >(owner_ptr);
+	}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+
+	template<class _Ty, size_t _N, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<stnii_small_vector<_Ty, _N, _A> >& owner_ptr) {
+		return mse::impl::ns_stnii_vector::xscope_structure_lock_guard<stnii_small_vector<_Ty, _N, _A> >(owner_ptr);
+	}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template<class _Ty, size_t _N, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<stnii_small_vector<_Ty, _N, _A> >& owner_ptr) {
+		return mse::impl::ns_stnii_vector::xscope_structure_lock_guard<stnii_small_vector<_Ty, _N, _A> >(owner_ptr);
+	}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+
 
 	namespace mstd {
 #ifndef MSE_MSTDVECTOR_DISABLED
@@ -2488,6 +3064,146 @@ namespace mse {
 			template<class _TContainer> class xscope_const_structure_lock_guard;
 		}
 
+		namespace impl {
+			namespace ns_msevector {
+				/* TMMIteratorSlots<> is a "slot map" that holds the states of the (registered) "mm" iterators that msevector<>
+				keeps updated. The states are stored contiguously in fixed-size blocks of slots. A block, once allocated, is
+				never moved, so the address of a slot remains stable, and released slots are recycled via a free list. So once
+				the high-water mark of simultaneously live iterators has been reached, registering and releasing iterators
+				doesn't allocate, and updating all the iterators (upon insertion or removal of elements) is just a linear scan
+				over the blocks. The block list and free list are allocated with (a rebound copy of) the given allocator. But the
+				blocks themselves can be kept alive by element handles, which may outlive not just the slot map, but also the
+				allocator's memory resource, so they are allocated from the global heap. */
+				template<class TMMIterator, class _TAlloc = std::allocator<TMMIterator> >
+				class TMMIteratorSlots {
+				public:
+					static const std::size_t sc_num_slots_per_block = 16/*arbitrary*/;
+
+					class CBlock {
+					public:
+						CBlock() {}
+						CBlock(const CBlock&) = delete;
+						CBlock& operator=(const CBlock&) = delete;
+						~CBlock() {
+							for (std::size_t i = 0; i < sc_num_slots_per_block; i += 1) {
+								if (m_is_occupied[i]) { slot(i).~TMMIterator(); }
+							}
+						}
+						TMMIterator& slot(std::size_t i) { return *reinterpret_cast<TMMIterator*>(std::addressof(m_storage[i])); }
+
+						typename std::aligned_storage<sizeof(TMMIterator), alignof(TMMIterator)>::type m_storage[sc_num_slots_per_block];
+						bool m_is_occupied[sc_num_slots_per_block] = {};
+					};
+
+					class handle_type {
+					public:
+						handle_type(std::size_t slot_index, TMMIterator* ptr) : m_ptr(ptr), m_slot_index(slot_index) {}
+						std::size_t slot_index() const { return m_slot_index; }
+					private:
+						TMMIterator* m_ptr = nullptr;
+						std::size_t m_slot_index = 0;
+						friend class TMMIteratorSlots;
+					};
+
+					explicit TMMIteratorSlots(const _TAlloc& _Al = _TAlloc()) : m_blocks(block_shptr_allocator_type(_Al)), m_free_slot_indices(index_allocator_type(_Al)) {}
+					TMMIteratorSlots(const TMMIteratorSlots&) = delete;
+					TMMIteratorSlots& operator=(const TMMIteratorSlots&) = delete;
+
+					template<class TOwner>
+					handle_type allocate(TOwner& owner_ref) {
+						std::size_t slot_index = m_num_slots_used;
+						if (!m_free_slot_indices.empty()) {
+							slot_index = m_free_slot_indices.back();
+						}
+						else if (m_blocks.size() * sc_num_slots_per_block <= slot_index) {
+							m_blocks.push_back(std::make_shared<CBlock>());
+							/* Reserving the free list capacity up front ensures that releasing a slot never allocates (or throws). */
+							m_free_slot_indices.reserve(m_blocks.size() * sc_num_slots_per_block);
+						}
+						auto& block_ref = *(m_blocks[slot_index / sc_num_slots_per_block]);
+						const auto i = slot_index % sc_num_slots_per_block;
+						auto ptr = ::new (static_cast<void*>(std::addressof(block_ref.m_storage[i]))) TMMIterator(owner_ref);
+						block_ref.m_is_occupied[i] = true;
+						if (!m_free_slot_indices.empty()) {
+							m_free_slot_indices.pop_back();
+						}
+						else {
+							m_num_slots_used += 1;
+						}
+						m_num_occupied_slots += 1;
+						return handle_type(slot_index, ptr);
+					}
+					void release(const handle_type& handle) {
+						if (!is_valid(handle)) {
+							MSE_THROW(msevector_range_error("invalid handle - void release(const handle_type& handle) - msevector::TMMIteratorSlots"));
+						}
+						auto& block_ref = *(m_blocks[handle.m_slot_index / sc_num_slots_per_block]);
+						const auto i = handle.m_slot_index % sc_num_slots_per_block;
+						block_ref.slot(i).~TMMIterator();
+						block_ref.m_is_occupied[i] = false;
+						m_free_slot_indices.push_back(handle.m_slot_index);
+						m_num_occupied_slots -= 1;
+					}
+					/* Releases all the slots for which the given predicate returns true. */
+					template<typename TPredicate>
+					void release_if(const TPredicate& pred) {
+						T_apply_to_all_slots([this, &pred](CBlock& block_ref, std::size_t i, std::size_t slot_index) {
+							if (pred(block_ref.slot(i))) {
+								block_ref.slot(i).~TMMIterator();
+								block_ref.m_is_occupied[i] = false;
+								m_free_slot_indices.push_back(slot_index);
+								m_num_occupied_slots -= 1;
+							}
+						});
+					}
+					TMMIterator& item(const handle_type& handle) const { return *(handle.m_ptr); }
+					/* Returns a shared_ptr to the slot that keeps the slot's block alive (even after the slot map is destroyed). */
+					std::shared_ptr<TMMIterator> shared_item_ptr(const handle_type& handle) const {
+						return std::shared_ptr<TMMIterator>(m_blocks[handle.m_slot_index / sc_num_slots_per_block], handle.m_ptr);
+					}
+					bool is_empty() const { return (0 == m_num_occupied_slots); }
+
+					template<typename TFn>
+					void T_apply_to_all(const TFn& func_obj_ref) {
+						T_apply_to_all_slots([&func_obj_ref](CBlock& block_ref, std::size_t i, std::size_t) { func_obj_ref(block_ref.slot(i)); });
+					}
+
+				private:
+					bool is_valid(const handle_type& handle) const {
+						if (m_num_slots_used <= handle.m_slot_index) { return false; }
+						auto& block_ref = *(m_blocks[handle.m_slot_index / sc_num_slots_per_block]);
+						const auto i = handle.m_slot_index % sc_num_slots_per_block;
+						return (block_ref.m_is_occupied[i]) && (std::addressof(block_ref.slot(i)) == handle.m_ptr);
+					}
+					template<typename TFn>
+					void T_apply_to_all_slots(const TFn& func_obj_ref) {
+						if (0 == m_num_occupied_slots) { return; }
+						std::size_t block_start_index = 0;
+						for (auto& block_shptr : m_blocks) {
+							if (m_num_slots_used <= block_start_index) { break; }
+							auto& block_ref = *block_shptr;
+							const std::size_t num_remaining_slots = m_num_slots_used - block_start_index;
+							const std::size_t num_slots = (sc_num_slots_per_block < num_remaining_slots) ? std::size_t(sc_num_slots_per_block) : num_remaining_slots;
+							for (std::size_t i = 0; i < num_slots; i += 1) {
+								if (block_ref.m_is_occupied[i]) {
+									func_obj_ref(block_ref, i, block_start_index + i);
+								}
+							}
+							block_start_index += sc_num_slots_per_block;
+						}
+					}
+
+					typedef typename std::allocator_traits<_TAlloc>::template rebind_alloc<std::shared_ptr<CBlock> > block_shptr_allocator_type;
+					typedef typename std::allocator_traits<_TAlloc>::template rebind_alloc<std::size_t> index_allocator_type;
+
+					std::vector<std::shared_ptr<CBlock>, block_shptr_allocator_type> m_blocks;
+					std::vector<std::size_t, index_allocator_type> m_free_slot_indices;
+					std::size_t m_num_slots_used = 0;
+					std::size_t m_num_occupied_slots = 0;
+				};
+			}
+		}
+
 		/* msevector<> is an unsafe extension of stnii_vector<> that provides the traditional begin() and end() (non-static)
 		member functions that return unsafe iterators. It also provides ss_begin() and ss_end() (non-static) member
 		functions which return bounds-checked, but still technically unsafe iterators. */
@@ -2495,7 +3211,7 @@ namespace mse {
 		class msevector : public stnii_vector<_Ty, _A>/*, public us::impl::AsyncNotShareableTagBase*/ {
 		public:
 			typedef stnii_vector<_Ty, _A> base_class;
-			typedef std::vector<_Ty, _A> std_vector;
+			typedef typename base_class::std_vector std_vector;
 			typedef msevector _Myt;
 
 			typedef typename base_class::allocator_type allocator_type;
@@ -2510,10 +3226,19 @@ namespace mse {
 				: base_class(_Al), m_mmitset(*this) {
 				/*m_debug_size = size();*/
 			}
+			/* Constructs from a pointer convertible to the allocator type (such as a std::pmr::memory_resource pointer). (Without
+			this constructor such a construction would be ambiguous with the (implicit) conversions to the base class.) */
+			template<class _TAllocatorPointer, class = typename std::enable_if<(std::is_pointer<_TAllocatorPointer>::value)
+				&& (std::is_convertible<_TAllocatorPointer, _A>::value), void>::type>
+			explicit msevector(_TAllocatorPointer _Al_ptr) : msevector(_A(_Al_ptr)) {}
 			explicit msevector(size_type _N)
 				: base_class(msev_as_a_size_t(_N)), m_mmitset(*this) {
 				/*m_debug_size = size();*/
 			}
+			msevector(size_type _N, const _A& _Al)
+				: base_class(msev_as_a_size_t(_N), _Al), m_mmitset(*this) {
+				/*m_debug_size = size();*/
+			}
 			explicit msevector(size_type _N, const _Ty& _V, const _A& _Al = _A())
 				: base_class(msev_as_a_size_t(_N), _V, _Al), m_mmitset(*this) {
 				/*m_debug_size = size();*/
@@ -2522,8 +3247,12 @@ namespace mse {
 			msevector(const std_vector& _X) : base_class(_X), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msevector(base_class&& _X) : base_class(std::forward<decltype(_X)>(_X)), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			msevector(const base_class& _X) : base_class(_X), m_mmitset(*this) { /*m_debug_size = size();*/ }
-			msevector(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X)), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msevector(std_vector&& _X, const _A& _Al) : base_class(std::forward<decltype(_X)>(_X), _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msevector(const std_vector& _X, const _A& _Al) : base_class(_X, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msevector(_Myt&& _X) : base_class(std::forward<decltype(_X)>(_X)), m_mmitset(*this) { /*m_debug_size = size();*/ _X.m_mmitset.reset(); }
+			msevector(_Myt&& _X, const _A& _Al) : base_class(std::forward<base_class>(_X), _Al), m_mmitset(*this) { /*m_debug_size = size();*/ _X.m_mmitset.reset(); }
 			msevector(const _Myt& _X) : base_class(_X), m_mmitset(*this) { /*m_debug_size = size();*/ }
+			msevector(const _Myt& _X, const _A& _Al) : base_class(_X, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
 			typedef typename base_class::const_iterator _It;
 			/* Note that safety cannot be guaranteed when using these constructors that take unsafe typename base_class::iterator and/or pointer parameters. */
 			msevector(_It _F, _It _L, const _A& _Al = _A()) : base_class(_F, _L, _Al), m_mmitset(*this) { /*m_debug_size = size();*/ }
@@ -2548,6 +3277,7 @@ namespace mse {
 				structure_change_guard<decltype(m_structure_change_mutex)> lock2(m_structure_change_mutex);
 				base_class::operator=(std::forward<decltype(_X)>(_X));
 				m_mmitset.reset();
+				_X.m_mmitset.reset();
 				return (*this);
 			}
 			_Myt& operator=(const _Myt& _X) {
@@ -2999,13 +3729,98 @@ namespace mse {
 					return retval;
 				}
 			}
+
+			/* insert_many() and erase_many() are "batched" versions of insert() and erase(). Rather than shifting the
+			elements and updating the registered (ipointer and element_handle) iterators once per inserted or erased element,
+			they move each element at most once and update the registered iterators in a single sweep. */
+
+			/* Inserts each given value before the element at the given index, where the indices refer to positions in the
+			vector before any of the insertions (an index equal to size() appends). Values with the same index are inserted
+			in the order given. */
+			void insert_many(std::vector<std::pair<size_type, _Ty> > index_value_pairs) {
+				structure_change_guard<decltype(m_structure_change_mutex)> lock2(m_structure_change_mutex);
+				const auto original_size = size_type((*this).size());
+				for (const auto& index_value_pair : index_value_pairs) {
+					if (original_size < index_value_pair.first) { MSE_THROW(msevector_range_error("index out of range - void insert_many() - msevector")); }
+				}
+				const auto num_inserts = size_type(index_value_pairs.size());
+				if (0 == num_inserts) { return; }
+				std::stable_sort(index_value_pairs.begin(), index_value_pairs.end(), [](const std::pair<size_type, _Ty>& a, const std::pair<size_type, _Ty>& b) { return (a.first < b.first); });
+
+				/* The vector is first extended (by temporarily appending the new values), then the existing elements and new
+				values are merged into place, from back to front. */
+				base_class::reserve(msev_as_a_size_t(original_size + num_inserts));
+				for (auto& index_value_pair : index_value_pairs) {
+					base_class::push_back(std::move(index_value_pair.second));
+				}
+				auto first = base_class::begin();
+				for (size_type i = 0; num_inserts > i; i += 1) {
+					index_value_pairs[i].second = std::move(first[original_size + i]);
+				}
+				auto upper_index = original_size;
+				for (auto j = num_inserts; 0 < j; j -= 1) {
+					const auto index = index_value_pairs[j - 1].first;
+					std::move_backward(first + index, first + upper_index, first + (upper_index + j));
+					first[index + (j - 1)] = std::move(index_value_pairs[j - 1].second);
+					upper_index = index;
+				}
+				/*m_debug_size = size();*/
+
+				if (!m_mmitset.is_empty()) {
+					m_mmitset.remap_indices([&index_value_pairs](msev_size_t old_index, msev_size_t& new_index) {
+						const auto index = size_type(msev_as_a_size_t(old_index));
+						auto it = std::upper_bound(index_value_pairs.begin(), index_value_pairs.end(), index
+							, [](const size_type& a, const std::pair<size_type, _Ty>& b) { return (a < b.first); });
+						new_index = msev_size_t(index + size_type(std::distance(index_value_pairs.begin(), it)));
+						return true;
+					});
+				}
+			}
+			/* Erases the elements at the given indices (which refer to positions in the vector before any of the erasures).
+			Duplicate indices are ignored. */
+			void erase_many(std::vector<size_type> indices) {
+				structure_change_guard<decltype(m_structure_change_mutex)> lock2(m_structure_change_mutex);
+				const auto original_size = size_type((*this).size());
+				std::sort(indices.begin(), indices.end());
+				indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+				if (indices.empty()) { return; }
+				if (original_size <= indices.back()) { MSE_THROW(msevector_range_error("index out of range - void erase_many() - msevector")); }
+
+				auto first = base_class::begin();
+				auto write_index = indices.front();
+				auto next_erased_it = indices.cbegin();
+				for (auto read_index = indices.front(); original_size > read_index; read_index += 1) {
+					if ((indices.cend() != next_erased_it) && ((*next_erased_it) == read_index)) {
+						++next_erased_it;
+					}
+					else {
+						first[write_index] = std::move(first[read_index]);
+						write_index += 1;
+					}
+				}
+				base_class::erase(first + write_index, base_class::end());
+				/*m_debug_size = size();*/
+
+				if (!m_mmitset.is_empty()) {
+					m_mmitset.remap_indices([&indices](msev_size_t old_index, msev_size_t& new_index) {
+						const auto index = size_type(msev_as_a_size_t(old_index));
+						auto it = std::lower_bound(indices.cbegin(), indices.cend(), index);
+						if ((indices.cend() != it) && ((*it) == index)) {
+							return false;
+						}
+						new_index = msev_size_t(index - size_type(std::distance(indices.cbegin(), it)));
+						return true;
+					});
+				}
+			}
+
 			void clear() {
 				structure_change_guard<decltype(m_structure_change_mutex)> lock2(m_structure_change_mutex);
 				base_class::clear();
 				/*m_debug_size = size();*/
 				m_mmitset.reset();
 			}
-			void swap(std::vector<_Ty, _A>& _X) {
+			void swap(std_vector& _X) {
 				structure_change_guard<decltype(m_structure_change_mutex)> lock2(m_structure_change_mutex);
 				base_class::swap(_X);
 				/*m_debug_size = size();*/
@@ -3020,6 +3835,7 @@ namespace mse {
 			void swap(_Myt& _X) {
 				(*this).swap(static_cast<base_class&>(_X));
 				m_mmitset.reset();
+				_X.m_mmitset.reset();
 			}
 			template<typename _TStateMutex2, template<typename> class _TTXScopeConstIterator2>
 			void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2>& _X) {
@@ -3156,6 +3972,9 @@ namespace mse {
 				MSE_INHERITED_RANDOM_ACCESS_MEMBER_TYPE_DECLARATIONS(_Myt);
 			};
 
+			class element_handle;
+			class const_element_handle;
+
 			/* mm_const_iterator_type acts much like a list iterator. */
 			class mm_const_iterator_type : public random_access_const_iterator_base {
 			public:
@@ -3169,7 +3988,10 @@ namespace mse {
 				typedef typename base_class::const_iterator::reference reference;
 				typedef typename base_class::const_reference const_reference;
 
-				void reset() { set_to_end_marker(); }
+				void reset() {
+					if (m_is_element_tracker) { detach(); }
+					else { set_to_end_marker(); }
+				}
 				bool points_to_an_item() const {
 					if (m_points_to_an_item) { assert((1 <= m_owner_cptr->size()) && (m_index < m_owner_cptr->size())); return true; }
 					else { assert(!((1 <= m_owner_cptr->size()) && (m_index < m_owner_cptr->size()))); return false; }
@@ -3318,6 +4140,7 @@ namespace mse {
 					}
 				}
 				void shift_inclusive_range(msev_size_t index_of_first, msev_size_t index_of_last, msev_int shift) {
+					if (m_is_detached) { return; }
 					if ((index_of_first <= (*this).m_index) && (index_of_last >= (*this).m_index)) {
 						auto new_index = (*this).m_index + shift;
 						if ((0 > new_index) || (m_owner_cptr->size() < new_index)) {
@@ -3346,12 +4169,26 @@ namespace mse {
 				void sync_const_iterator_to_index() {
 					assert(m_owner_cptr->size() >= (*this).m_index);
 				}
+				/* Iterators that serve as element trackers (for element_handles) are not moved to the end marker when their
+				element is removed. Instead they are "detached", and remain so, ignoring any subsequent shifts in position. */
+				void detach() {
+					m_is_detached = true;
+					m_points_to_an_item = false;
+				}
+				void orphan() {
+					detach();
+					m_owner_cptr = nullptr;
+				}
+
 				msev_bool m_points_to_an_item = false;
 				msev_size_t m_index = 0;
 				const _Myt* m_owner_cptr = nullptr;
+				msev_bool m_is_element_tracker = false;
+				msev_bool m_is_detached = false;
 				friend class mm_iterator_set_type;
 				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
 				friend class mm_iterator_type;
+				friend class const_element_handle;
 			};
 			/* mm_iterator_type acts much like a list iterator. */
 			class mm_iterator_type : random_access_iterator_base {
@@ -3364,7 +4201,10 @@ namespace mse {
 				typedef typename base_class::iterator::pointer pointer;
 				typedef typename base_class::iterator::reference reference;
 
-				void reset() { set_to_end_marker(); }
+				void reset() {
+					if (m_is_element_tracker) { detach(); }
+					else { set_to_end_marker(); }
+				}
 				bool points_to_an_item() const {
 					if (m_points_to_an_item) { assert((1 <= m_owner_ptr->size()) && (m_index < m_owner_ptr->size())); return true; }
 					else { assert(!((1 <= m_owner_ptr->size()) && (m_index < m_owner_ptr->size())));  return false; }
@@ -3513,6 +4353,7 @@ namespace mse {
 					}
 				}
 				void shift_inclusive_range(msev_size_t index_of_first, msev_size_t index_of_last, msev_int shift) {
+					if (m_is_detached) { return; }
 					if ((index_of_first <= (*this).m_index) && (index_of_last >= (*this).m_index)) {
 						auto new_index = (*this).m_index + shift;
 						if ((0 > new_index) || (m_owner_ptr->size() < new_index)) {
@@ -3542,284 +4383,221 @@ namespace mse {
 				void sync_iterator_to_index() {
 					assert(m_owner_ptr->size() >= (*this).m_index);
 				}
+				/* Iterators that serve as element trackers (for element_handles) are not moved to the end marker when their
+				element is removed. Instead they are "detached", and remain so, ignoring any subsequent shifts in position. */
+				void detach() {
+					m_is_detached = true;
+					m_points_to_an_item = false;
+				}
+				void orphan() {
+					detach();
+					m_owner_ptr = nullptr;
+				}
+
 				msev_bool m_points_to_an_item = false;
 				msev_size_t m_index = 0;
 				_Myt* m_owner_ptr = nullptr;
+				msev_bool m_is_element_tracker = false;
+				msev_bool m_is_detached = false;
 				friend class mm_iterator_set_type;
 				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
+				friend class element_handle;
 			};
 
-		private:
-			typedef std::size_t CHashKey1;
-			class mm_const_iterator_handle_type {
+			/* mm_intrusive_iterator_node<> holds the state of an "mm" iterator in the node object itself (rather than in a slot
+			allocated by the vector), and links itself into a (doubly) linked list, owned by the vector, that is threaded through
+			the nodes themselves (in the manner of CCRegisteredNode). So constructing and destroying a node never allocates, and
+			accessing the iterator state doesn't involve any indirection through the vector. The vector updates the listed
+			iterators along with the slotted ones. Note that, unlike cipointers and ipointers, nodes must not outlive the vector
+			(ivector<>'s iterators, for example, hold a reference counting pointer to the vector). */
+			template<class TMMIterator, class TOwner>
+			class mm_intrusive_iterator_node {
 			public:
-				mm_const_iterator_handle_type(const CHashKey1& key_cref, const std::shared_ptr<mm_const_iterator_type>& shptr_cref) : m_shptr(shptr_cref), m_key(key_cref) {}
+				mm_intrusive_iterator_node(TOwner& owner_ref) : m_mm_iterator(owner_ref), m_owner_ptr(std::addressof(owner_ref)) {
+					m_owner_ptr->m_mmitset.link(*this);
+				}
+				mm_intrusive_iterator_node(const mm_intrusive_iterator_node& src_cref) : m_mm_iterator(*(src_cref.m_owner_ptr)), m_owner_ptr(src_cref.m_owner_ptr) {
+					m_mm_iterator = src_cref.m_mm_iterator;
+					m_owner_ptr->m_mmitset.link(*this);
+				}
+				~mm_intrusive_iterator_node() {
+					if (m_owner_ptr) { m_owner_ptr->m_mmitset.unlink(*this); }
+				}
+				mm_intrusive_iterator_node& operator=(const mm_intrusive_iterator_node& _Right_cref) {
+					m_mm_iterator = _Right_cref.m_mm_iterator;
+					return (*this);
+				}
+				TMMIterator& mm_iterator() const { return m_mm_iterator; }
+				TOwner* owner_ptr() const { return m_owner_ptr; }
+
 			private:
-				std::shared_ptr<mm_const_iterator_type> m_shptr;
-				CHashKey1 m_key;
-				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
+				mutable TMMIterator m_mm_iterator;
+				TOwner* m_owner_ptr = nullptr;
+				mm_intrusive_iterator_node* m_prev_ptr = nullptr;
+				mm_intrusive_iterator_node* m_next_ptr = nullptr;
 				friend class mm_iterator_set_type;
-			};
-			class mm_iterator_handle_type {
-			public:
-				mm_iterator_handle_type(const CHashKey1& key_cref, const std::shared_ptr<mm_iterator_type>& shptr_ref) : m_shptr(shptr_ref), m_key(key_cref) {}
-			private:
-				std::shared_ptr<mm_iterator_type> m_shptr;
-				CHashKey1 m_key;
 				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
-				friend class mm_iterator_set_type;
 			};
+			typedef mm_intrusive_iterator_node<mm_const_iterator_type, const _Myt> mm_intrusive_const_iterator_node_type;
+			typedef mm_intrusive_iterator_node<mm_iterator_type, _Myt> mm_intrusive_iterator_node_type;
+
+		private:
+			typedef mse::us::impl::ns_msevector::TMMIteratorSlots<mm_const_iterator_type, _A> mm_const_iterator_slots_type;
+			typedef mse::us::impl::ns_msevector::TMMIteratorSlots<mm_iterator_type, _A> mm_iterator_slots_type;
+			typedef typename mm_const_iterator_slots_type::handle_type mm_const_iterator_handle_type;
+			typedef typename mm_iterator_slots_type::handle_type mm_iterator_handle_type;
 
 			class mm_iterator_set_type {
 			public:
-				class CMMConstIterators : public std::unordered_map<CHashKey1, std::shared_ptr<mm_const_iterator_type>> {};
-				class CMMIterators : public std::unordered_map<CHashKey1, std::shared_ptr<mm_iterator_type>> {};
-
-				class assignable_CMMConstIterators_value_type : public std::pair<CHashKey1, std::shared_ptr<mm_const_iterator_type>> {
-				public:
-					assignable_CMMConstIterators_value_type() {}
-					assignable_CMMConstIterators_value_type(const typename CMMConstIterators::value_type& src) : std::pair<CHashKey1, std::shared_ptr<mm_iterator_type>>(src.first, src.second) {}
-					assignable_CMMConstIterators_value_type& operator=(const typename CMMConstIterators::value_type& rhs) { (*this).first = rhs.first; (*this).second = rhs.second; return (*this); }
-					operator typename CMMConstIterators::value_type() const { return typename CMMConstIterators::value_type((*this).first, (*this).second); }
-				};
-				class assignable_CMMIterators_value_type : public std::pair<CHashKey1, std::shared_ptr<mm_iterator_type>> {
-				public:
-					assignable_CMMIterators_value_type() {}
-					assignable_CMMIterators_value_type(const typename CMMIterators::value_type& src) : std::pair<CHashKey1, std::shared_ptr<mm_iterator_type>>(src.first, src.second) {}
-					assignable_CMMIterators_value_type& operator=(const typename CMMIterators::value_type& rhs) { (*this).first = rhs.first; (*this).second = rhs.second; return (*this); }
-					operator typename CMMIterators::value_type() const { return typename CMMIterators::value_type((*this).first, (*this).second); }
-				};
-
 				~mm_iterator_set_type() {
-					if (!mm_const_fast_mode1()) {
-						delete m_aux_mm_const_iterator_shptrs_ptr;
-					}
-					if (!mm_fast_mode1()) {
-						delete m_aux_mm_iterator_shptrs_ptr;
-					}
+					/* Any outstanding element trackers are disassociated from the (soon to be destroyed) owner. */
+					orphan_element_trackers();
+					/* Any outstanding intrusive nodes are (in violation of their usage requirements) outliving the owner. We
+					disassociate them from it so that at least their destruction will be benign. */
+					T_orphan_intrusive_nodes(m_intrusive_const_iterators_head_ptr);
+					T_orphan_intrusive_nodes(m_intrusive_iterators_head_ptr);
 				}
 
 				template<typename TFn>
-				void T_apply_to_all_mm_const_iterator_shptrs(const TFn& func_obj_ref) {
-					if (!mm_const_fast_mode1()) {
-						for (auto it = (*m_aux_mm_const_iterator_shptrs_ptr).begin(); (*m_aux_mm_const_iterator_shptrs_ptr).end() != it; it++) {
-							func_obj_ref((*it).second);
-						}
-					}
-					else {
-						for (int i = 0; i < m_fm1_num_mm_const_iterators; i += 1) {
-							func_obj_ref(m_fm1_key_mm_const_it_array[i].second);
-						}
+				void T_apply_to_all_mm_const_iterators(const TFn& func_obj_ref) {
+					m_mm_const_iterator_slots.T_apply_to_all(func_obj_ref);
+					for (auto node_ptr = m_intrusive_const_iterators_head_ptr; node_ptr; node_ptr = node_ptr->m_next_ptr) {
+						func_obj_ref(node_ptr->m_mm_iterator);
 					}
 				}
 				template<typename TFn>
-				void T_apply_to_all_mm_iterator_shptrs(const TFn& func_obj_ref) {
-					if (!mm_fast_mode1()) {
-						for (auto it = (*m_aux_mm_iterator_shptrs_ptr).begin(); (*m_aux_mm_iterator_shptrs_ptr).end() != it; it++) {
-							func_obj_ref((*it).second);
-						}
-					}
-					else {
-						for (int i = 0; i < m_fm1_num_mm_iterators; i += 1) {
-							func_obj_ref(m_fm1_key_mm_it_array[i].second);
-						}
+				void T_apply_to_all_mm_iterators(const TFn& func_obj_ref) {
+					m_mm_iterator_slots.T_apply_to_all(func_obj_ref);
+					for (auto node_ptr = m_intrusive_iterators_head_ptr; node_ptr; node_ptr = node_ptr->m_next_ptr) {
+						func_obj_ref(node_ptr->m_mm_iterator);
 					}
 				}
-				mm_iterator_set_type(_Myt& owner_ref) : m_next_available_key(0), m_owner_ptr(&owner_ref) {}
+				/* The iterator states are allocated with the owner's allocator. */
+				mm_iterator_set_type(_Myt& owner_ref) : m_mm_const_iterator_slots(owner_ref.get_allocator())
+					, m_mm_iterator_slots(owner_ref.get_allocator()), m_owner_ptr(&owner_ref) {}
 				void reset() {
 					/* We can use "static" here because the lambda function does not capture any parameters. */
-					T_apply_to_all_mm_const_iterator_shptrs([](std::shared_ptr<mm_const_iterator_type>& a) { a->reset(); });
-					T_apply_to_all_mm_iterator_shptrs([](std::shared_ptr<mm_iterator_type>& a) { a->reset(); });
+					T_apply_to_all_mm_const_iterators([](mm_const_iterator_type& a) { a.reset(); });
+					T_apply_to_all_mm_iterators([](mm_iterator_type& a) { a.reset(); });
 				}
 				void sync_iterators_to_index() {
 					/* No longer used. Relic from when mm_iterator_type contained a "native" iterator. */
 					/*
-					T_apply_to_all_mm_const_iterator_shptrs([](std::shared_ptr<mm_const_iterator_type>& a) { a->sync_const_iterator_to_index(); });
-					T_apply_to_all_mm_iterator_shptrs([](std::shared_ptr<mm_iterator_type>& a) { a->sync_iterator_to_index(); });
+					T_apply_to_all_mm_const_iterators([](mm_const_iterator_type& a) { a.sync_const_iterator_to_index(); });
+					T_apply_to_all_mm_iterators([](mm_iterator_type& a) { a.sync_iterator_to_index(); });
 					*/
 				}
 				void invalidate_inclusive_range(msev_size_t start_index, msev_size_t end_index) {
-					T_apply_to_all_mm_const_iterator_shptrs([start_index, end_index](std::shared_ptr<mm_const_iterator_type>& a) { a->invalidate_inclusive_range(start_index, end_index); });
-					T_apply_to_all_mm_iterator_shptrs([start_index, end_index](std::shared_ptr<mm_iterator_type>& a) { a->invalidate_inclusive_range(start_index, end_index); });
+					T_apply_to_all_mm_const_iterators([start_index, end_index](mm_const_iterator_type& a) { a.invalidate_inclusive_range(start_index, end_index); });
+					T_apply_to_all_mm_iterators([start_index, end_index](mm_iterator_type& a) { a.invalidate_inclusive_range(start_index, end_index); });
 				}
 				void shift_inclusive_range(msev_size_t start_index, msev_size_t end_index, msev_int shift) {
-					T_apply_to_all_mm_const_iterator_shptrs([start_index, end_index, shift](std::shared_ptr<mm_const_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); });
-					T_apply_to_all_mm_iterator_shptrs([start_index, end_index, shift](std::shared_ptr<mm_iterator_type>& a) { a->shift_inclusive_range(start_index, end_index, shift); });
+					T_apply_to_all_mm_const_iterators([start_index, end_index, shift](mm_const_iterator_type& a) { a.shift_inclusive_range(start_index, end_index, shift); });
+					T_apply_to_all_mm_iterators([start_index, end_index, shift](mm_iterator_type& a) { a.shift_inclusive_range(start_index, end_index, shift); });
+				}
+				/* Applies the given (monotonic) mapping of old indices to new indices to all the (non-detached) iterators in a
+				single sweep. Iterators whose target element was removed (indicated by the mapping function returning false)
+				are reset. */
+				template<typename TFn>
+				void remap_indices(const TFn& func_obj_ref) {
+					T_apply_to_all_mm_const_iterators([&func_obj_ref](mm_const_iterator_type& a) { remap_index(a, func_obj_ref); });
+					T_apply_to_all_mm_iterators([&func_obj_ref](mm_iterator_type& a) { remap_index(a, func_obj_ref); });
 				}
 				bool is_empty() const {
-					if (mm_const_fast_mode1()) {
-						if (1 <= m_fm1_num_mm_const_iterators) {
-							return false;
-						}
-					}
-					else {
-						if (1 <= m_aux_mm_const_iterator_shptrs_ptr->size()) {
-							return false;
-						}
-					}
-					if (mm_fast_mode1()) {
-						if (1 <= m_fm1_num_mm_iterators) {
-							return false;
-						}
-					}
-					else {
-						if (1 <= m_aux_mm_iterator_shptrs_ptr->size()) {
-							return false;
-						}
-					}
-					return true;
+					return (m_mm_const_iterator_slots.is_empty() && m_mm_iterator_slots.is_empty()
+						&& (!m_intrusive_const_iterators_head_ptr) && (!m_intrusive_iterators_head_ptr));
 				}
 
+				void link(mm_intrusive_const_iterator_node_type& node_ref) { T_link(m_intrusive_const_iterators_head_ptr, node_ref); }
+				void unlink(mm_intrusive_const_iterator_node_type& node_ref) { T_unlink(m_intrusive_const_iterators_head_ptr, node_ref); }
+				void link(mm_intrusive_iterator_node_type& node_ref) { T_link(m_intrusive_iterators_head_ptr, node_ref); }
+				void unlink(mm_intrusive_iterator_node_type& node_ref) { T_unlink(m_intrusive_iterators_head_ptr, node_ref); }
+
 				mm_const_iterator_handle_type allocate_new_const_item_pointer() {
-					//auto shptr = std::shared_ptr<mm_const_iterator_type>(new mm_const_iterator_type(*m_owner_ptr));
-					auto shptr = std::make_shared<mm_const_iterator_type>(*m_owner_ptr);
-					auto key = m_next_available_key; m_next_available_key++;
-					mm_const_iterator_handle_type retval(key, shptr);
-					typename CMMConstIterators::value_type new_item(key, shptr);
-					if (!mm_const_fast_mode1()) {
-						(*m_aux_mm_const_iterator_shptrs_ptr).insert(new_item);
-					}
-					else {
-						if (sc_fm1_max_mm_iterators == m_fm1_num_mm_const_iterators) {
-							/* Too many items. Initiate and switch to slow mode. */
-							/* Initialize slow storage. */
-							m_aux_mm_const_iterator_shptrs_ptr = new CMMConstIterators();
-							/* First copy the items from fast storage to slow storage. */
-							for (int i = 0; i < sc_fm1_max_mm_iterators; i += 1) {
-								(*m_aux_mm_const_iterator_shptrs_ptr).insert(m_fm1_key_mm_const_it_array[i]);
-							}
-							/* Add the new items to slow storage. */
-							(*m_aux_mm_const_iterator_shptrs_ptr).insert(new_item);
-						}
-						else {
-							m_fm1_key_mm_const_it_array[m_fm1_num_mm_const_iterators] = new_item;
-							m_fm1_num_mm_const_iterators += 1;
-						}
-					}
-					return retval;
+					return m_mm_const_iterator_slots.allocate(*m_owner_ptr);
 				}
 				void release_const_item_pointer(mm_const_iterator_handle_type handle) {
-					if (!mm_const_fast_mode1()) {
-						auto it = (*m_aux_mm_const_iterator_shptrs_ptr).find(handle.m_key);
-						if ((*m_aux_mm_const_iterator_shptrs_ptr).end() != it) {
-							(*m_aux_mm_const_iterator_shptrs_ptr).erase(it);
-						}
-						else {
-							/* Do we need to throw here? */
-							MSE_THROW(msevector_range_error("invalid handle - void release_aux_mm_const_iterator(mm_const_iterator_handle_type handle) - msevector::mm_iterator_set_type"));
-						}
-					}
-					else {
-						int found_index = -1;
-						for (int i = 0; i < m_fm1_num_mm_const_iterators; i += 1) {
-							if (handle.m_key == m_fm1_key_mm_const_it_array[i].first) {
-								found_index = i;
-								break;
-							}
-						}
-						if (0 <= found_index) {
-							m_fm1_num_mm_const_iterators -= 1;
-							assert(0 <= m_fm1_num_mm_const_iterators);
-							for (int j = found_index; j < m_fm1_num_mm_const_iterators; j += 1) {
-								m_fm1_key_mm_const_it_array[j] = m_fm1_key_mm_const_it_array[j + 1];
-							}
-						}
-						else {
-							/* Do we need to throw here? */
-							MSE_THROW(msevector_range_error("invalid handle - void release_aux_mm_const_iterator(mm_const_iterator_handle_type handle) - msevector::mm_iterator_set_type"));
-						}
-					}
+					m_mm_const_iterator_slots.release(handle);
 				}
 
 				mm_iterator_handle_type allocate_new_item_pointer() {
-					//auto shptr = std::shared_ptr<mm_iterator_type>(new mm_iterator_type(*m_owner_ptr));
-					auto shptr = std::make_shared<mm_iterator_type>(*m_owner_ptr);
-					auto key = m_next_available_key; m_next_available_key++;
-					mm_iterator_handle_type retval(key, shptr);
-					typename CMMIterators::value_type new_item(key, shptr);
-					if (!mm_fast_mode1()) {
-						(*m_aux_mm_iterator_shptrs_ptr).insert(new_item);
-					}
-					else {
-						if (sc_fm1_max_mm_iterators == m_fm1_num_mm_iterators) {
-							/* Too many items. Initiate and switch to slow mode. */
-							/* Initialize slow storage. */
-							m_aux_mm_iterator_shptrs_ptr = new CMMIterators();
-							/* First copy the items from fast storage to slow storage. */
-							for (int i = 0; i < sc_fm1_max_mm_iterators; i += 1) {
-								(*m_aux_mm_iterator_shptrs_ptr).insert(m_fm1_key_mm_it_array[i]);
-							}
-							/* Add the new items to slow storage. */
-							(*m_aux_mm_iterator_shptrs_ptr).insert(new_item);
-						}
-						else {
-							m_fm1_key_mm_it_array[m_fm1_num_mm_iterators] = new_item;
-							m_fm1_num_mm_iterators += 1;
-						}
-					}
-					return retval;
+					return m_mm_iterator_slots.allocate(*m_owner_ptr);
 				}
 				void release_item_pointer(mm_iterator_handle_type handle) {
-					if (!mm_fast_mode1()) {
-						auto it = (*m_aux_mm_iterator_shptrs_ptr).find(handle.m_key);
-						if ((*m_aux_mm_iterator_shptrs_ptr).end() != it) {
-							(*m_aux_mm_iterator_shptrs_ptr).erase(it);
-						}
-						else {
-							/* Do we need to throw here? */
-							MSE_THROW(msevector_range_error("invalid handle - void release_aux_mm_iterator(mm_iterator_handle_type handle) - msevector::mm_iterator_set_type"));
-						}
-					}
-					else {
-						int found_index = -1;
-						for (int i = 0; i < m_fm1_num_mm_iterators; i += 1) {
-							if (handle.m_key == m_fm1_key_mm_it_array[i].first) {
-								found_index = i;
-								break;
-							}
-						}
-						if (0 <= found_index) {
-							m_fm1_num_mm_iterators -= 1;
-							assert(0 <= m_fm1_num_mm_iterators);
-							for (int j = found_index; j < m_fm1_num_mm_iterators; j += 1) {
-								m_fm1_key_mm_it_array[j] = m_fm1_key_mm_it_array[j + 1];
-							}
-						}
-						else {
-							/* Do we need to throw here? */
-							MSE_THROW(msevector_range_error("invalid handle - void release_aux_mm_iterator(mm_iterator_handle_type handle) - msevector::mm_iterator_set_type"));
-						}
-					}
+					m_mm_iterator_slots.release(handle);
 				}
 				void release_all_item_pointers() {
-					if (!mm_fast_mode1()) {
-						(*m_aux_mm_iterator_shptrs_ptr).clear();
-					}
-					else {
-						for (int i = 0; i < m_fm1_num_mm_iterators; i += 1) {
-							m_fm1_key_mm_it_array[i] = assignable_CMMIterators_value_type();
-						}
-						m_fm1_num_mm_iterators = 0;
-					}
+					detach_element_trackers();
+					m_mm_iterator_slots.release_if([](const mm_iterator_type& a) { return !a.m_is_element_tracker; });
 				}
 				mm_const_iterator_type &const_item_pointer(mm_const_iterator_handle_type handle) const {
-					return (*(handle.m_shptr));
+					return m_mm_const_iterator_slots.item(handle);
 				}
 				mm_iterator_type &item_pointer(mm_iterator_handle_type handle) {
-					return (*(handle.m_shptr));
+					return m_mm_iterator_slots.item(handle);
+				}
+				std::shared_ptr<mm_const_iterator_type> shared_const_item_pointer(mm_const_iterator_handle_type handle) const {
+					return m_mm_const_iterator_slots.shared_item_ptr(handle);
+				}
+				std::shared_ptr<mm_iterator_type> shared_item_pointer(mm_iterator_handle_type handle) const {
+					return m_mm_iterator_slots.shared_item_ptr(handle);
 				}
 
 			private:
 				void release_all_const_item_pointers() {
-					if (!mm_const_fast_mode1()) {
-						(*m_aux_mm_const_iterator_shptrs_ptr).clear();
+					detach_element_trackers();
+					m_mm_const_iterator_slots.release_if([](const mm_const_iterator_type& a) { return !a.m_is_element_tracker; });
+				}
+				template<typename TMMIterator, typename TFn>
+				static void remap_index(TMMIterator& a, const TFn& func_obj_ref) {
+					if (a.m_is_detached) { return; }
+					msev_size_t new_index = 0;
+					if (func_obj_ref(a.m_index, new_index)) {
+						a.m_index = new_index;
 					}
 					else {
-						for (int i = 0; i < m_fm1_num_mm_const_iterators; i += 1) {
-							m_fm1_key_mm_const_it_array[i] = assignable_CMMConstIterators_value_type();
-						}
-						m_fm1_num_mm_const_iterators = 0;
+						a.reset();
+					}
+				}
+				template<typename TNode>
+				static void T_link(TNode*& head_ptr_ref, TNode& node_ref) {
+					node_ref.m_prev_ptr = nullptr;
+					node_ref.m_next_ptr = head_ptr_ref;
+					if (head_ptr_ref) { head_ptr_ref->m_prev_ptr = std::addressof(node_ref); }
+					head_ptr_ref = std::addressof(node_ref);
+				}
+				template<typename TNode>
+				static void T_unlink(TNode*& head_ptr_ref, TNode& node_ref) {
+					if (node_ref.m_prev_ptr) { node_ref.m_prev_ptr->m_next_ptr = node_ref.m_next_ptr; }
+					else { assert(std::addressof(node_ref) == head_ptr_ref); head_ptr_ref = node_ref.m_next_ptr; }
+					if (node_ref.m_next_ptr) { node_ref.m_next_ptr->m_prev_ptr = node_ref.m_prev_ptr; }
+					node_ref.m_prev_ptr = nullptr;
+					node_ref.m_next_ptr = nullptr;
+				}
+				template<typename TNode>
+				static void T_orphan_intrusive_nodes(TNode*& head_ptr_ref) {
+					auto node_ptr = head_ptr_ref;
+					while (node_ptr) {
+						auto next_ptr = node_ptr->m_next_ptr;
+						node_ptr->m_owner_ptr = nullptr;
+						node_ptr->m_prev_ptr = nullptr;
+						node_ptr->m_next_ptr = nullptr;
+						node_ptr = next_ptr;
 					}
+					head_ptr_ref = nullptr;
+				}
+				/* Element trackers are (only) released by the element handles referencing them. While the owner is alive, its
+				element trackers are merely detached (rather than orphaned), so that they remain associated with the owner,
+				and each one's slot is returned to the owner's free list when its element handle is released. */
+				void detach_element_trackers() {
+					T_apply_to_all_mm_const_iterators([](mm_const_iterator_type& a) { if (a.m_is_element_tracker) { a.detach(); } });
+					T_apply_to_all_mm_iterators([](mm_iterator_type& a) { if (a.m_is_element_tracker) { a.detach(); } });
+				}
+				/* Upon the owner's destruction, its element trackers are orphaned. Their slots (along with the rest of the slot
+				block) are freed when the last element handle referencing the block is released. */
+				void orphan_element_trackers() {
+					T_apply_to_all_mm_const_iterators([](mm_const_iterator_type& a) { if (a.m_is_element_tracker) { a.orphan(); } });
+					T_apply_to_all_mm_iterators([](mm_iterator_type& a) { if (a.m_is_element_tracker) { a.orphan(); } });
 				}
 
 				mm_iterator_set_type& operator=(const mm_iterator_set_type& src_cref) {
@@ -3834,19 +4612,10 @@ namespace mse {
 				mm_iterator_set_type(const mm_iterator_set_type& src) { /* see above */ }
 				mm_iterator_set_type(const mm_iterator_set_type&& src) { /* see above */ }
 
-				CHashKey1 m_next_available_key = 0;
-
-				static const int sc_fm1_max_mm_iterators = 6/*arbitrary*/;
-
-				bool mm_const_fast_mode1() const { return (nullptr == m_aux_mm_const_iterator_shptrs_ptr); }
-				int m_fm1_num_mm_const_iterators = 0;
-				assignable_CMMConstIterators_value_type m_fm1_key_mm_const_it_array[sc_fm1_max_mm_iterators];
-				CMMConstIterators* m_aux_mm_const_iterator_shptrs_ptr = nullptr;
-
-				bool mm_fast_mode1() const { return (nullptr == m_aux_mm_iterator_shptrs_ptr); }
-				int m_fm1_num_mm_iterators = 0;
-				assignable_CMMIterators_value_type m_fm1_key_mm_it_array[sc_fm1_max_mm_iterators];
-				CMMIterators* m_aux_mm_iterator_shptrs_ptr = nullptr;
+				mm_const_iterator_slots_type m_mm_const_iterator_slots;
+				mm_iterator_slots_type m_mm_iterator_slots;
+				mm_intrusive_const_iterator_node_type* m_intrusive_const_iterators_head_ptr = nullptr;
+				mm_intrusive_iterator_node_type* m_intrusive_iterators_head_ptr = nullptr;
 
 				_Myt* m_owner_ptr = nullptr;
 
@@ -3882,21 +4651,16 @@ namespace mse {
 				typedef typename mm_const_iterator_type::reference reference;
 				typedef typename mm_const_iterator_type::const_reference const_reference;
 
-				cipointer(const _Myt& owner_cref) : m_owner_cptr(&owner_cref) {
-					mm_const_iterator_handle_type handle = m_owner_cptr->allocate_new_const_item_pointer();
-					m_handle_shptr = std::make_shared<mm_const_iterator_handle_type>(handle);
-				}
-				cipointer(const cipointer& src_cref) : m_owner_cptr(src_cref.m_owner_cptr) {
-					mm_const_iterator_handle_type handle = m_owner_cptr->allocate_new_const_item_pointer();
-					m_handle_shptr = std::make_shared<mm_const_iterator_handle_type>(handle);
+				cipointer(const _Myt& owner_cref) : m_owner_cptr(&owner_cref), m_handle(owner_cref.allocate_new_const_item_pointer()) {}
+				cipointer(const cipointer& src_cref) : m_owner_cptr(src_cref.m_owner_cptr), m_handle(src_cref.m_owner_cptr->allocate_new_const_item_pointer()) {
 					const_item_pointer() = src_cref.const_item_pointer();
 				}
 				~cipointer() {
-					m_owner_cptr->release_const_item_pointer(*m_handle_shptr);
+					m_owner_cptr->release_const_item_pointer(m_handle);
 				}
-				mm_const_iterator_type& const_item_pointer() const { return m_owner_cptr->const_item_pointer(*m_handle_shptr); }
+				mm_const_iterator_type& const_item_pointer() const { return m_owner_cptr->const_item_pointer(m_handle); }
 				mm_const_iterator_type& cip() const { return const_item_pointer(); }
-				//const mm_const_iterator_handle_type& handle() const { return (*m_handle_shptr); }
+				//const mm_const_iterator_handle_type& handle() const { return m_handle; }
 
 				void reset() { const_item_pointer().reset(); }
 				bool points_to_an_item() const { return const_item_pointer().points_to_an_item(); }
@@ -3942,7 +4706,7 @@ namespace mse {
 				void async_not_shareable_and_not_passable_tag() const {}
 			private:
 				const _Myt* m_owner_cptr = nullptr;
-				std::shared_ptr<mm_const_iterator_handle_type> m_handle_shptr;
+				mm_const_iterator_handle_type m_handle;
 				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
 			};
 			class ipointer : public random_access_iterator_base {
@@ -3954,21 +4718,16 @@ namespace mse {
 				typedef typename mm_iterator_type::pointer pointer;
 				typedef typename mm_iterator_type::reference reference;
 
-				ipointer(_Myt& owner_ref) : m_owner_ptr(&owner_ref) {
-					mm_iterator_handle_type handle = m_owner_ptr->allocate_new_item_pointer();
-					m_handle_shptr = std::make_shared<mm_iterator_handle_type>(handle);
-				}
-				ipointer(const ipointer& src_cref) : m_owner_ptr(src_cref.m_owner_ptr) {
-					mm_iterator_handle_type handle = m_owner_ptr->allocate_new_item_pointer();
-					m_handle_shptr = std::make_shared<mm_iterator_handle_type>(handle);
+				ipointer(_Myt& owner_ref) : m_owner_ptr(&owner_ref), m_handle(owner_ref.allocate_new_item_pointer()) {}
+				ipointer(const ipointer& src_cref) : m_owner_ptr(src_cref.m_owner_ptr), m_handle(src_cref.m_owner_ptr->allocate_new_item_pointer()) {
 					item_pointer() = src_cref.item_pointer();
 				}
 				~ipointer() {
-					m_owner_ptr->release_item_pointer(*m_handle_shptr);
+					m_owner_ptr->release_item_pointer(m_handle);
 				}
-				mm_iterator_type& item_pointer() const { return m_owner_ptr->item_pointer(*m_handle_shptr); }
+				mm_iterator_type& item_pointer() const { return m_owner_ptr->item_pointer(m_handle); }
 				mm_iterator_type& ip() const { return item_pointer(); }
-				//const mm_iterator_handle_type& handle() const { return (*m_handle_shptr); }
+				//const mm_iterator_handle_type& handle() const { return m_handle; }
 				operator cipointer() const {
 					cipointer retval(*m_owner_ptr);
 					retval.const_item_pointer().set_to_beginning();
@@ -4020,10 +4779,182 @@ namespace mse {
 				void async_not_shareable_and_not_passable_tag() const {}
 			private:
 				_Myt* m_owner_ptr = nullptr;
-				std::shared_ptr<mm_iterator_handle_type> m_handle_shptr;
+				mm_iterator_handle_type m_handle;
 				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
 			};
 
+			/* element_handle is a (non-owning) "registered" pointer to an element of the vector. Rather than requiring each element
+			to be wrapped in a TRegisteredObj<> (which would add per-element overhead and break up the dense storage of the
+			elements), element handles are tracked by the vector itself (via the same mechanism that supports ipointers), which
+			adjusts their position as elements are inserted or erased, and sets them to null when their element is removed or
+			the vector is destroyed. */
+			class element_handle {
+			public:
+				typedef typename mm_iterator_type::value_type value_type;
+				typedef typename mm_iterator_type::pointer pointer;
+				typedef typename mm_iterator_type::reference reference;
+
+				element_handle() {}
+				element_handle(std::nullptr_t) {}
+				element_handle(_Myt& owner_ref, size_type index) { attach(owner_ref, index); }
+				element_handle(const element_handle& src_cref) {
+					if (src_cref) { attach(*(src_cref.m_tracker_shptr->m_owner_ptr), src_cref.position()); }
+				}
+				element_handle(element_handle&& src) : m_tracker_shptr(std::move(src.m_tracker_shptr)), m_slot_index(src.m_slot_index) {}
+				~element_handle() { release(); }
+
+				element_handle& operator=(const element_handle& _Right_cref) {
+					if (std::addressof(_Right_cref) != this) {
+						release();
+						if (_Right_cref) { attach(*(_Right_cref.m_tracker_shptr->m_owner_ptr), _Right_cref.position()); }
+					}
+					return (*this);
+				}
+				element_handle& operator=(element_handle&& _Right) {
+					if (std::addressof(_Right) != this) {
+						release();
+						m_tracker_shptr = std::move(_Right.m_tracker_shptr);
+						m_slot_index = _Right.m_slot_index;
+					}
+					return (*this);
+				}
+				element_handle& operator=(std::nullptr_t) { release(); return (*this); }
+
+				/* Returns false if the handle is null or its target element no longer exists. */
+				explicit operator bool() const { return (m_tracker_shptr) && (!m_tracker_shptr->m_is_detached); }
+				reference operator*() const {
+					if (!(*this)) { MSE_THROW(msevector_null_dereference_error("attempt to dereference null or invalid element_handle - msevector")); }
+					return (*m_tracker_shptr).operator*();
+				}
+				pointer operator->() const { return std::addressof(operator*()); }
+				/* The current index of the target element in the vector. */
+				msev_size_t position() const {
+					if (!(*this)) { MSE_THROW(msevector_null_dereference_error("attempt to use null or invalid element_handle - msevector")); }
+					return m_tracker_shptr->position();
+				}
+				_Myt* target_container_ptr() const { return (*this) ? m_tracker_shptr->m_owner_ptr : nullptr; }
+
+				bool operator==(const element_handle& _Right_cref) const {
+					if (!(*this)) { return !_Right_cref; }
+					return (_Right_cref) && (target_container_ptr() == _Right_cref.target_container_ptr()) && (position() == _Right_cref.position());
+				}
+				bool operator!=(const element_handle& _Right_cref) const { return !((*this) == _Right_cref); }
+				void async_not_shareable_and_not_passable_tag() const {}
+
+			private:
+				void attach(_Myt& owner_ref, size_type index) {
+					if (owner_ref.size() <= index) { MSE_THROW(msevector_range_error("index out of range - element_handle - msevector")); }
+					mm_iterator_handle_type handle = owner_ref.allocate_new_item_pointer();
+					auto& tracker_ref = owner_ref.item_pointer(handle);
+					tracker_ref.m_is_element_tracker = true;
+					tracker_ref.advance(msev_int(index));
+					m_tracker_shptr = owner_ref.m_mmitset.shared_item_pointer(handle);
+					m_slot_index = handle.slot_index();
+				}
+				void release() {
+					if (m_tracker_shptr) {
+						/* An "orphaned" tracker has already been disassociated from its (destroyed) owner. */
+						auto owner_ptr = m_tracker_shptr->m_owner_ptr;
+						if (owner_ptr) {
+							owner_ptr->release_item_pointer(mm_iterator_handle_type(m_slot_index, m_tracker_shptr.get()));
+						}
+						m_tracker_shptr = nullptr;
+					}
+				}
+
+				std::shared_ptr<mm_iterator_type> m_tracker_shptr;
+				std::size_t m_slot_index = 0;
+				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
+				friend class const_element_handle;
+			};
+			class const_element_handle {
+			public:
+				typedef typename mm_const_iterator_type::value_type value_type;
+				typedef typename mm_const_iterator_type::const_pointer const_pointer;
+				typedef typename mm_const_iterator_type::const_reference const_reference;
+
+				const_element_handle() {}
+				const_element_handle(std::nullptr_t) {}
+				const_element_handle(const _Myt& owner_cref, size_type index) { attach(owner_cref, index); }
+				const_element_handle(const const_element_handle& src_cref) {
+					if (src_cref) { attach(*(src_cref.m_tracker_shptr->m_owner_cptr), src_cref.position()); }
+				}
+				const_element_handle(const element_handle& src_cref) {
+					if (src_cref) { attach(*(src_cref.m_tracker_shptr->m_owner_ptr), src_cref.position()); }
+				}
+				const_element_handle(const_element_handle&& src) : m_tracker_shptr(std::move(src.m_tracker_shptr)), m_slot_index(src.m_slot_index) {}
+				~const_element_handle() { release(); }
+
+				const_element_handle& operator=(const const_element_handle& _Right_cref) {
+					if (std::addressof(_Right_cref) != this) {
+						release();
+						if (_Right_cref) { attach(*(_Right_cref.m_tracker_shptr->m_owner_cptr), _Right_cref.position()); }
+					}
+					return (*this);
+				}
+				const_element_handle& operator=(const_element_handle&& _Right) {
+					if (std::addressof(_Right) != this) {
+						release();
+						m_tracker_shptr = std::move(_Right.m_tracker_shptr);
+						m_slot_index = _Right.m_slot_index;
+					}
+					return (*this);
+				}
+				const_element_handle& operator=(std::nullptr_t) { release(); return (*this); }
+
+				/* Returns false if the handle is null or its target element no longer exists. */
+				explicit operator bool() const { return (m_tracker_shptr) && (!m_tracker_shptr->m_is_detached); }
+				const_reference operator*() const {
+					if (!(*this)) { MSE_THROW(msevector_null_dereference_error("attempt to dereference null or invalid const_element_handle - msevector")); }
+					return (*m_tracker_shptr).operator*();
+				}
+				const_pointer operator->() const { return std::addressof(operator*()); }
+				/* The current index of the target element in the vector. */
+				msev_size_t position() const {
+					if (!(*this)) { MSE_THROW(msevector_null_dereference_error("attempt to use null or invalid const_element_handle - msevector")); }
+					return m_tracker_shptr->position();
+				}
+				const _Myt* target_container_ptr() const { return (*this) ? m_tracker_shptr->m_owner_cptr : nullptr; }
+
+				bool operator==(const const_element_handle& _Right_cref) const {
+					if (!(*this)) { return !_Right_cref; }
+					return (_Right_cref) && (target_container_ptr() == _Right_cref.target_container_ptr()) && (position() == _Right_cref.position());
+				}
+				bool operator!=(const const_element_handle& _Right_cref) const { return !((*this) == _Right_cref); }
+				void async_not_shareable_and_not_passable_tag() const {}
+
+			private:
+				void attach(const _Myt& owner_cref, size_type index) {
+					if (owner_cref.size() <= index) { MSE_THROW(msevector_range_error("index out of range - const_element_handle - msevector")); }
+					mm_const_iterator_handle_type handle = owner_cref.allocate_new_const_item_pointer();
+					auto& tracker_ref = owner_cref.const_item_pointer(handle);
+					tracker_ref.m_is_element_tracker = true;
+					tracker_ref.advance(msev_int(index));
+					m_tracker_shptr = owner_cref.m_mmitset.shared_const_item_pointer(handle);
+					m_slot_index = handle.slot_index();
+				}
+				void release() {
+					if (m_tracker_shptr) {
+						/* An "orphaned" tracker has already been disassociated from its (destroyed) owner. */
+						auto owner_cptr = m_tracker_shptr->m_owner_cptr;
+						if (owner_cptr) {
+							owner_cptr->release_const_item_pointer(mm_const_iterator_handle_type(m_slot_index, m_tracker_shptr.get()));
+						}
+						m_tracker_shptr = nullptr;
+					}
+				}
+
+				std::shared_ptr<mm_const_iterator_type> m_tracker_shptr;
+				std::size_t m_slot_index = 0;
+				friend class /*_Myt*/msevector<_Ty, _A, _TStateMutex>;
+			};
+
+			/* Returns a handle to the element at the given index that remains associated with that element (rather than the
+			index) as other elements are inserted or erased, and becomes null when the element is removed. */
+			element_handle make_element_handle(size_type index) { return element_handle(*this, index); }
+			const_element_handle make_element_handle(size_type index) const { return const_element_handle(*this, index); }
+			const_element_handle make_const_element_handle(size_type index) const { return const_element_handle(*this, index); }
+
 			ipointer ibegin() {	// return ipointer for beginning of mutable sequence
 				ipointer retval(*this);
 				retval.set_to_beginning();
@@ -4673,21 +5604,6 @@ namespace mse {
 				std::lock_guard<_Mutex> m_lock_guard;
 			};
 
-			/* These are a couple of functions that are basically just here for the convenience of the mstd::vector<>
-			implementation, which uses this class. */
-#ifdef MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
-			void note_parent_destruction() { m_parent_destroyed = true; }
-			void assert_parent_not_destroyed() const {
-				/* This assert can fail if, for example, you dereference an mstd::vector<> iterator after the vector has
-				been destroyed. You can supress this assert by defining MSE_SUPPRESS_MSTD_VECTOR_CHECK_USE_AFTER_FREE. */
-				assert(!m_parent_destroyed);
-			}
-			bool m_parent_destroyed = false;
-#else // MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
-			void note_parent_destruction() {}
-			void assert_parent_not_destroyed() const {}
-#endif // MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
-
 			mutable _TStateMutex m_structure_change_mutex;
 
 			auto contained_vector() const -> decltype(base_class::contained_vector()) { return base_class::contained_vector(); }
@@ -4903,6 +5819,27 @@ namespace mse {
 	/* Overloads for rsv::TReturnableFParam<>. */
 	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_cipointer)
 	MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_ipointer)
+
+#ifdef MSE_HAS_MEMORY_RESOURCE
+	namespace pmr {
+		/* Versions of the vectors that use std::pmr::polymorphic_allocator<>, analogous to std::pmr::vector<>. */
+		template<class _Ty>
+		using nii_vector = mse::nii_vector<_Ty, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty>
+		using stnii_vector = mse::stnii_vector<_Ty, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty>
+		using mtnii_vector = mse::mtnii_vector<_Ty, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty, size_t _N>
+		using nii_small_vector = mse::nii_small_vector<_Ty, _N, std::pmr::polymorphic_allocator<_Ty> >;
+		template<class _Ty, size_t _N>
+		using stnii_small_vector = mse::stnii_small_vector<_Ty, _N, std::pmr::polymorphic_allocator<_Ty> >;
+
+		namespace us {
+			template<class _Ty>
+			using msevector = mse::us::msevector<_Ty, std::pmr::polymorphic_allocator<_Ty> >;
+		}
+	}
+#endif // MSE_HAS_MEMORY_RESOURCE
 }
 
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
@@ -296,56 +296,68 @@ namespace mse {
 			operator mse::nii_basic_string<_Ty, _Traits, _A>() const { return msebasic_string(); }
 			operator std::basic_string<_Ty, _Traits, _A>() const { return msebasic_string(); }
 
-			explicit basic_string(const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_Al)) {}
-			explicit basic_string(size_type _N) : m_shptr(std::make_shared<_MBS>(_N)) {}
+			explicit basic_string(const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _Al)) {}
+			explicit basic_string(size_type _N) : m_shptr(s_make_msebasic_string_shptr(_A(), _N)) {}
 #ifdef MSE_HAS_CXX17
 			template<class _Alloc2 = _A, std::enable_if_t<mse::impl::_mse_Is_allocator<_Alloc2>::value, int> = 0>
 #endif /* MSE_HAS_CXX17 */
-			explicit basic_string(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_N, _V, _Al)) {}
-			basic_string(_Myt&& _X) : m_shptr(std::make_shared<_MBS>(std::forward<decltype(_X)>(_X).msebasic_string())) {}
+			explicit basic_string(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _N, _V, _Al)) {}
+			basic_string(_Myt&& _X) : m_shptr(s_make_msebasic_string_shptr(_X.get_allocator(), std::forward<decltype(_X)>(_X).msebasic_string())) {}
 			basic_string(const _Myt& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
-			basic_string(_MBS&& _X) : m_shptr(std::make_shared<_MBS>(std::forward<decltype(_X)>(_X))) {}
+			basic_string(_Myt&& _X, const _A& _Al) : m_shptr(s_make_msebasic_string_shptr(_Al, std::forward<decltype(_X)>(_X).msebasic_string(), _Al)) {}
+			basic_string(const _Myt& _X, const _A& _Al) : m_shptr(s_make_msebasic_string_shptr(_Al, _X.msebasic_string(), _Al)) {}
+			basic_string(_MBS&& _X) : m_shptr(s_make_msebasic_string_shptr(_X.get_allocator(), std::forward<decltype(_X)>(_X))) {}
 			basic_string(const _MBS& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
-			basic_string(mse::nii_basic_string<_Ty, _Traits>&& _X) : m_shptr(std::make_shared<_MBS>(std::forward<decltype(_X)>(_X))) {}
-			basic_string(const mse::nii_basic_string<_Ty, _Traits>& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
-			basic_string(std::basic_string<_Ty, _Traits>&& _X) : m_shptr(std::make_shared<_MBS>(std::forward<decltype(_X)>(_X))) {}
-			basic_string(const std::basic_string<_Ty, _Traits>& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
+			basic_string(mse::nii_basic_string<_Ty, _Traits, _A>&& _X) : m_shptr(s_make_msebasic_string_shptr(_X.get_allocator(), std::forward<decltype(_X)>(_X))) {}
+			basic_string(const mse::nii_basic_string<_Ty, _Traits, _A>& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
+			basic_string(std::basic_string<_Ty, _Traits, _A>&& _X) : m_shptr(s_make_msebasic_string_shptr(_X.get_allocator(), std::forward<decltype(_X)>(_X))) {}
+			basic_string(const std::basic_string<_Ty, _Traits, _A>& _X) : basic_string(mse::us::unsafe_make_xscope_const_pointer_to(_X)) {}
 			typedef typename _MBS::const_iterator _It;
-			basic_string(_It _F, _It _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_F, _L, _Al)) {}
-			basic_string(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_F, _L, _Al)) {}
+			basic_string(_It _F, _It _L, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _F, _L, _Al)) {}
+			basic_string(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _F, _L, _Al)) {}
 			template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			basic_string(_Iter _First, _Iter _Last) : m_shptr(std::make_shared<_MBS>(_First, _Last)) {}
+			basic_string(_Iter _First, _Iter _Last) : m_shptr(s_make_msebasic_string_shptr(_A(), _First, _Last)) {}
 			template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			basic_string(_Iter _First, _Iter _Last, const _A& _Al) : m_shptr(std::make_shared<_MBS>(_First, _Last, _Al)) {}
-			basic_string(const _Ty* const _Ptr) : m_shptr(std::make_shared<_MBS>(_Ptr)) {}
-			basic_string(const _Ty* const _Ptr, const size_t _Count) : m_shptr(std::make_shared<_MBS>(_Ptr, _Count)) {}
-			basic_string(const _Myt& _X, const size_type _Roff, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_X.msebasic_string(), _Roff, npos, _Al)) {}
-			basic_string(const _Myt& _X, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_X.msebasic_string(), _Roff, _Count, _Al)) {}
-
-			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr) : m_shptr(std::make_shared<_MBS>(xs_ptr->msebasic_string())) {}
-			basic_string(const mse::TXScopeFixedConstPointer<_MBS>& xs_ptr) : m_shptr(std::make_shared<_MBS>(*xs_ptr)) {}
-			basic_string(const mse::TXScopeFixedConstPointer<mse::nii_basic_string<_Ty, _Traits> >& xs_ptr) : m_shptr(std::make_shared<_MBS>(*xs_ptr)) {}
-			basic_string(const mse::TXScopeFixedConstPointer<std::basic_string<_Ty, _Traits> >& xs_ptr) : m_shptr(std::make_shared<_MBS>(*xs_ptr)) {}
-			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr, const size_type _Roff, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(xs_ptr->msebasic_string(), _Roff, npos, _Al)) {}
-			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(xs_ptr->msebasic_string(), _Roff, _Count, _Al)) {}
+			basic_string(_Iter _First, _Iter _Last, const _A& _Al) : m_shptr(s_make_msebasic_string_shptr(_Al, _First, _Last, _Al)) {}
+			basic_string(const _Ty* const _Ptr) : m_shptr(s_make_msebasic_string_shptr(_A(), _Ptr)) {}
+			basic_string(const _Ty* const _Ptr, const size_t _Count) : m_shptr(s_make_msebasic_string_shptr(_A(), _Ptr, _Count)) {}
+			basic_string(const _Ty* const _Ptr, const _A& _Al) : m_shptr(s_make_msebasic_string_shptr(_Al, _Ptr, _Al)) {}
+			basic_string(const _Ty* const _Ptr, const size_t _Count, const _A& _Al) : m_shptr(s_make_msebasic_string_shptr(_Al, _Ptr, _Count, _Al)) {}
+			basic_string(const _Myt& _X, const size_type _Roff, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _X.msebasic_string(), _Roff, npos, _Al)) {}
+			basic_string(const _Myt& _X, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _X.msebasic_string(), _Roff, _Count, _Al)) {}
+
+			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr) : m_shptr(s_make_msebasic_string_shptr(s_copy_allocator(xs_ptr->get_allocator()), xs_ptr->msebasic_string())) {}
+			basic_string(const mse::TXScopeFixedConstPointer<_MBS>& xs_ptr) : m_shptr(s_make_msebasic_string_shptr(s_copy_allocator(xs_ptr->get_allocator()), *xs_ptr)) {}
+			basic_string(const mse::TXScopeFixedConstPointer<mse::nii_basic_string<_Ty, _Traits, _A> >& xs_ptr) : m_shptr(s_make_msebasic_string_shptr(s_copy_allocator(xs_ptr->get_allocator()), *xs_ptr)) {}
+			basic_string(const mse::TXScopeFixedConstPointer<std::basic_string<_Ty, _Traits, _A> >& xs_ptr) : m_shptr(s_make_msebasic_string_shptr(s_copy_allocator(xs_ptr->get_allocator()), *xs_ptr)) {}
+			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr, const size_type _Roff, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, xs_ptr->msebasic_string(), _Roff, npos, _Al)) {}
+			basic_string(const mse::TXScopeFixedConstPointer<_Myt>& xs_ptr, const size_type _Roff, const size_type _Count, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, xs_ptr->msebasic_string(), _Roff, _Count, _Al)) {}
 
 #ifdef MSE_HAS_CXX17
 			template<class _TParam1/*, class = _Is_string_view_or_section_ish<_TParam1>*/>
-			basic_string(const _TParam1& _Right) : m_shptr(std::make_shared<_MBS>()) { assign(_Right); }
+			basic_string(const _TParam1& _Right) : m_shptr(s_make_msebasic_string_shptr(_A())) { assign(_Right); }
 
 			template<class _TParam1/*, class = _Is_string_view_or_section_ish<_TParam1>*/>
 			basic_string(const _TParam1& _Right, const size_type _Roff, const size_type _Count, const _A& _Al = _A())
-				: m_shptr(std::make_shared<_MBS>(_Al)) {
+				: m_shptr(s_make_msebasic_string_shptr(_Al, _Al)) {
 				assign(_Right, _Roff, _Count);
 			}
 #else /* MSE_HAS_CXX17 */
 			/* construct from mse::string_view and "string sections". */
 			template<typename _TStringSection, class = typename std::enable_if<(std::is_base_of<mse::us::impl::StringSectionTagBase, _TStringSection>::value), void>::type>
-			explicit basic_string(const _TStringSection& _X) : m_shptr(std::make_shared<_MBS>(_X)) {}
+			explicit basic_string(const _TStringSection& _X) : m_shptr(s_make_msebasic_string_shptr(_A(), _X)) {}
 #endif /* MSE_HAS_CXX17 */
 
 			MSE_IMPL_DESTRUCTOR_PREFIX1 ~basic_string() {
 				msebasic_string().note_parent_destruction();
+				if ((!std::is_same<_A, std::allocator<_Ty> >::value) && (1 < m_shptr.use_count())) {
+					/* Outstanding iterators keep the contained string alive, but with a non-default allocator its element
+					storage may not remain valid after this basic_string (and potentially its allocator's memory resource) is
+					gone. So we release the element storage now, and any subsequent attempt to access an element through those
+					iterators will just result in an (out of range) exception. */
+					std::basic_string<_Ty, _Traits, _A> released_contents(msebasic_string().get_allocator());
+					msebasic_string().swap(released_contents);
+				}
 			}
 
 			_Myt& operator=(_MBS&& _X) { msebasic_string() = (std::forward<decltype(_X)>(_X)); return (*this); }
@@ -451,7 +463,7 @@ namespace mse {
 			template<typename _TStateMutex2, template<typename> class _TTXScopeConstIterator2>
 			void swap(mse::us::impl::gnii_basic_string<_Ty, _Traits, _A, _TStateMutex2, _TTXScopeConstIterator2>& _X) { m_shptr->swap(_X); }
 
-			basic_string(_XSTD initializer_list<typename _MBS::value_type> _Ilist, const _A& _Al = _A()) : m_shptr(std::make_shared<_MBS>(_Ilist, _Al)) {}
+			basic_string(_XSTD initializer_list<typename _MBS::value_type> _Ilist, const _A& _Al = _A()) : m_shptr(s_make_msebasic_string_shptr(_Al, _Ilist, _Al)) {}
 			_Myt& operator=(_XSTD initializer_list<typename _MBS::value_type> _Ilist) { msebasic_string() = (_Ilist); return (*this); }
 			void assign(_XSTD initializer_list<typename _MBS::value_type> _Ilist) { m_shptr->assign(_Ilist); }
 
@@ -678,7 +690,7 @@ namespace mse {
 
 
 			basic_string(const const_iterator &start, const const_iterator &end, const _A& _Al = _A())
-				: m_shptr(std::make_shared<_MBS>(start.msebasic_string_ss_const_iterator_type(), end.msebasic_string_ss_const_iterator_type(), _Al)) {}
+				: m_shptr(s_make_msebasic_string_shptr(_Al, start.msebasic_string_ss_const_iterator_type(), end.msebasic_string_ss_const_iterator_type(), _Al)) {}
 			void assign(const const_iterator &start, const const_iterator &end) {
 				m_shptr->assign(start.msebasic_string_ss_const_iterator_type(), end.msebasic_string_ss_const_iterator_type());
 			}
@@ -1325,6 +1337,15 @@ namespace mse {
 			template<class _TThisPointer>
 			static auto& s_msebasic_string(const _TThisPointer& this_pointer) { return this_pointer->msebasic_string(); }
 
+			/* Since iterators hold (strong) references to the contained string, it (and the shared_ptr control block) may
+			outlive not just this basic_string, but also its allocator's memory resource. So it is allocated from the global
+			heap. Only the string's element storage is allocated with the given allocator. */
+			template<typename ..._TArgs>
+			static std::shared_ptr<_MBS> s_make_msebasic_string_shptr(const _A& /*_Al*/, _TArgs&&... args) {
+				return std::make_shared<_MBS>(std::forward<_TArgs>(args)...);
+			}
+			static _A s_copy_allocator(const _A& _Al) { return std::allocator_traits<_A>::select_on_container_copy_construction(_Al); }
+
 			std::shared_ptr<_MBS> m_shptr;
 
 			friend xscope_const_iterator;
@@ -1678,6 +1699,22 @@ namespace mse {
 		using wstring = basic_string<wchar_t>;
 		using u16string = basic_string<char16_t>;
 		using u32string = basic_string<char32_t>;
+	}
+
+#ifdef MSE_HAS_MEMORY_RESOURCE
+	namespace pmr {
+		/* mstd::basic_string<> using std::pmr::polymorphic_allocator<>, analogous to std::pmr::basic_string<>. */
+		template<class _Ty, class _Traits = std::char_traits<_Ty> >
+		using basic_string = mse::mstd::basic_string<_Ty, _Traits, std::pmr::polymorphic_allocator<_Ty> >;
+
+		using string = basic_string<char>;
+		using wstring = basic_string<wchar_t>;
+		using u16string = basic_string<char16_t>;
+		using u32string = basic_string<char32_t>;
+	}
+#endif // MSE_HAS_MEMORY_RESOURCE
+
+	namespace mstd {
 
 		inline namespace literals {
 			inline namespace string_literals {
@@ -115,10 +115,63 @@ namespace mse {
 		public:
 			using std::range_error::range_error;
 		};
+		class mstdvector_use_after_free_error : public std::logic_error {
+		public:
+			using std::logic_error::logic_error;
+		};
 
 		template<class _Ty, class _A>
 		class vector;
 
+		namespace impl {
+			namespace ns_vector {
+				/* mstd::vector<> iterators need to be able to detect whether their target vector still exists. Each vector
+				allocates one of these (reference counted) flags the first time a (non-scope) iterator is requested, and each
+				of its iterators holds a reference to it. The vector clears the flag upon destruction. Vectors that never
+				produce (non-scope) iterators never allocate one. Since iterators may outlive not just the vector, but also its
+				allocator's memory resource, the flag is allocated from the global heap rather than with the vector's allocator. */
+				class CLivenessFlag {
+				public:
+					bool is_alive() const { return m_is_alive; }
+					void note_destruction() { m_is_alive = false; }
+
+					void add_ref() { m_ref_count.fetch_add(1, std::memory_order_relaxed); }
+					void release() {
+						if (1 == m_ref_count.fetch_sub(1, std::memory_order_acq_rel)) {
+							delete this;
+						}
+					}
+
+				private:
+					bool m_is_alive = true;
+					std::atomic<size_t> m_ref_count{ 1 };
+				};
+
+				class CLivenessFlagRef {
+				public:
+					CLivenessFlagRef() {}
+					/* Takes ownership of one (already counted) reference. */
+					explicit CLivenessFlagRef(CLivenessFlag* ptr) : m_ptr(ptr) {}
+					CLivenessFlagRef(const CLivenessFlagRef& src) : m_ptr(src.m_ptr) {
+						if (m_ptr) { m_ptr->add_ref(); }
+					}
+					CLivenessFlagRef(CLivenessFlagRef&& src) : m_ptr(src.m_ptr) { src.m_ptr = nullptr; }
+					~CLivenessFlagRef() {
+						if (m_ptr) { m_ptr->release(); }
+					}
+					CLivenessFlagRef& operator=(CLivenessFlagRef src) {
+						std::swap(m_ptr, src.m_ptr);
+						return (*this);
+					}
+					/* Returns false only if the flag exists and has been cleared. */
+					bool target_is_alive() const { return ((!m_ptr) || m_ptr->is_alive()); }
+
+				private:
+					CLivenessFlag* m_ptr = nullptr;
+				};
+			}
+		}
+
 		namespace ns_vector {
 			/* For each (scope) vector instance, only one instance of xscope_structure_lock_guard may exist at any one
 			time. While an instance of xscope_structure_lock_guard exists it ensures that direct (scope) pointers to
@@ -278,85 +331,97 @@ namespace mse {
 			operator mse::nii_vector<_Ty, _A>() const { return msevector(); }
 			operator std::vector<_Ty, _A>() const { return msevector(); }
 
-			explicit vector(const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_Al)) {}
-			explicit vector(size_type _N) : m_shptr(std::make_shared<_MV>(_N)) {}
-			explicit vector(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_N, _V, _Al)) {}
-			vector(_Myt&& _X) : m_shptr(std::make_shared<_MV>()) {
+			explicit vector(const _A& _Al = _A()) : m_msevector(_Al) {}
+			explicit vector(size_type _N) : m_msevector(_N) {}
+			vector(size_type _N, const _A& _Al) : m_msevector(_N, _Al) {}
+			explicit vector(size_type _N, const _Ty& _V, const _A& _Al = _A()) : m_msevector(_N, _V, _Al) {}
+			vector(_Myt&& _X) : m_msevector(std::move(_X.msevector())) {
 				static_assert(typename std::is_rvalue_reference<decltype(_X)>::type(), "");
-				/* It would be more efficient to just move _X.m_shptr into m_shptr, but that would leave _X in what we
-				would consider an invalid state. */
-				msevector() = std::move(_X.msevector());
 			}
-			vector(const _Myt& _X) : m_shptr(std::make_shared<_MV>(_X.msevector())) {}
-			vector(_MV&& _X) : m_shptr(std::make_shared<_MV>(std::forward<decltype(_X)>(_X))) {}
-			vector(const _MV& _X) : m_shptr(std::make_shared<_MV>(_X)) {}
-			vector(std::vector<_Ty>&& _X) : m_shptr(std::make_shared<_MV>(std::forward<decltype(_X)>(_X))) {}
-			vector(const std::vector<_Ty>& _X) : m_shptr(std::make_shared<_MV>(_X)) {}
+			vector(_Myt&& _X, const _A& _Al) : m_msevector(std::move(_X.msevector()), _Al) {}
+			vector(const _Myt& _X) : m_msevector(_X.msevector()) {}
+			vector(const _Myt& _X, const _A& _Al) : m_msevector(_X.msevector(), _Al) {}
+			vector(_MV&& _X) : m_msevector(std::forward<decltype(_X)>(_X)) {}
+			vector(const _MV& _X) : m_msevector(_X) {}
+			vector(std::vector<_Ty, _A>&& _X) : m_msevector(std::forward<decltype(_X)>(_X)) {}
+			vector(const std::vector<_Ty, _A>& _X) : m_msevector(_X) {}
+			vector(std::vector<_Ty, _A>&& _X, const _A& _Al) : m_msevector(std::forward<decltype(_X)>(_X), _Al) {}
+			vector(const std::vector<_Ty, _A>& _X, const _A& _Al) : m_msevector(_X, _Al) {}
 			typedef typename _MV::const_iterator _It;
-			vector(_It _F, _It _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_F, _L, _Al)) {}
-			vector(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_F, _L, _Al)) {}
+			vector(_It _F, _It _L, const _A& _Al = _A()) : m_msevector(_F, _L, _Al) {}
+			vector(const _Ty* _F, const _Ty* _L, const _A& _Al = _A()) : m_msevector(_F, _L, _Al) {}
 			template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			vector(_Iter _First, _Iter _Last) : m_shptr(std::make_shared<_MV>(_First, _Last)) {}
+			vector(_Iter _First, _Iter _Last) : m_msevector(_First, _Last) {}
 			template<class _Iter, class = typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, void>::type>
-			vector(_Iter _First, _Iter _Last, const _A& _Al) : m_shptr(std::make_shared<_MV>(_First, _Last, _Al)) {}
+			vector(_Iter _First, _Iter _Last, const _A& _Al) : m_msevector(_First, _Last, _Al) {}
 
 			MSE_IMPL_DESTRUCTOR_PREFIX1 ~vector() {
-				msevector().note_parent_destruction();
+				auto liveness_flag_ptr = m_liveness_flag_ptr.load(std::memory_order_acquire);
+				if (liveness_flag_ptr) {
+					liveness_flag_ptr->note_destruction();
+					liveness_flag_ptr->release();
+				}
 			}
 
 			_Myt& operator=(_MV&& _X) { msevector() = (std::forward<decltype(_X)>(_X)); return (*this); }
 			_Myt& operator=(const _MV& _X) { msevector() = (_X); return (*this); }
 			_Myt& operator=(_Myt&& _X) {
 				static_assert(typename std::is_rvalue_reference<decltype(_X)>::type(), "");
-				/* It would be more efficient to just move _X.m_shptr into m_shptr, but that would leave _X in what we
-				would consider an invalid state. */
 				msevector() = std::move(_X.msevector());
 				return (*this);
 			}
 			_Myt& operator=(const _Myt& _X) { msevector() = (_X.msevector()); return (*this); }
-			void reserve(size_type _Count) { m_shptr->reserve(_Count); }
-			void resize(size_type _N, const _Ty& _X = _Ty()) { m_shptr->resize(_N, _X); }
-			typename _MV::const_reference operator[](size_type _P) const { return m_shptr->operator[](_P); }
-			typename _MV::reference operator[](size_type _P) { return m_shptr->operator[](_P); }
-			void push_back(_Ty&& _X) { m_shptr->push_back(std::forward<decltype(_X)>(_X)); }
-			void push_back(const _Ty& _X) { m_shptr->push_back(_X); }
-			void pop_back() { m_shptr->pop_back(); }
-			void assign(_It _F, _It _L) { m_shptr->assign(_F, _L); }
-			void assign(size_type _N, const _Ty& _X = _Ty()) { m_shptr->assign(_N, _X); }
+			void reserve(size_type _Count) { m_msevector.reserve(_Count); }
+			void resize(size_type _N, const _Ty& _X = _Ty()) { m_msevector.resize(_N, _X); }
+			typename _MV::const_reference operator[](size_type _P) const { return m_msevector.operator[](_P); }
+			typename _MV::reference operator[](size_type _P) { return m_msevector.operator[](_P); }
+			void push_back(_Ty&& _X) { m_msevector.push_back(std::forward<decltype(_X)>(_X)); }
+			void push_back(const _Ty& _X) { m_msevector.push_back(_X); }
+			void pop_back() { m_msevector.pop_back(); }
+			void assign(_It _F, _It _L) { m_msevector.assign(_F, _L); }
+			void assign(size_type _N, const _Ty& _X = _Ty()) { m_msevector.assign(_N, _X); }
 			template<class ..._Valty>
-			void emplace_back(_Valty&& ..._Val) { m_shptr->emplace_back(std::forward<_Valty>(_Val)...); }
-			void clear() { m_shptr->clear(); }
-			void swap(_MV& _X) { m_shptr->swap(_X); }
-			void swap(_Myt& _X) { m_shptr->swap(_X.msevector()); }
-			void swap(std::vector<_Ty, _A>& _X) { m_shptr->swap(_X); }
+			void emplace_back(_Valty&& ..._Val) { m_msevector.emplace_back(std::forward<_Valty>(_Val)...); }
+			void clear() { m_msevector.clear(); }
+			void swap(_MV& _X) { m_msevector.swap(_X); }
+			void swap(_Myt& _X) { m_msevector.swap(_X.msevector()); }
+			void swap(std::vector<_Ty, _A>& _X) { m_msevector.swap(_X); }
 			template<typename _TStateMutex2, template<typename> class _TTXScopeConstIterator2>
-			void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2>& _X) { m_shptr->swap(_X); }
+			void swap(mse::us::impl::gnii_vector<_Ty, _A, _TStateMutex2, _TTXScopeConstIterator2>& _X) { m_msevector.swap(_X); }
 
-			vector(_XSTD initializer_list<typename _MV::value_type> _Ilist, const _A& _Al = _A()) : m_shptr(std::make_shared<_MV>(_Ilist, _Al)) {}
+			vector(_XSTD initializer_list<typename _MV::value_type> _Ilist, const _A& _Al = _A()) : m_msevector(_Ilist, _Al) {}
 			_Myt& operator=(_XSTD initializer_list<typename _MV::value_type> _Ilist) { msevector() = (_Ilist); return (*this); }
-			void assign(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_shptr->assign(_Ilist); }
-
-			size_type capacity() const _NOEXCEPT { return m_shptr->capacity(); }
-			void shrink_to_fit() { m_shptr->shrink_to_fit(); }
-			size_type size() const _NOEXCEPT { return m_shptr->size(); }
-			size_type max_size() const _NOEXCEPT { return m_shptr->max_size(); }
-			bool empty() const _NOEXCEPT { return m_shptr->empty(); }
-			_A get_allocator() const _NOEXCEPT { return m_shptr->get_allocator(); }
-			typename _MV::const_reference at(size_type _Pos) const { return m_shptr->at(_Pos); }
-			typename _MV::reference at(size_type _Pos) { return m_shptr->at(_Pos); }
-			typename _MV::reference front() { return m_shptr->front(); }
-			typename _MV::const_reference front() const { return m_shptr->front(); }
-			typename _MV::reference back() { return m_shptr->back(); }
-			typename _MV::const_reference back() const { return m_shptr->back(); }
+			void assign(_XSTD initializer_list<typename _MV::value_type> _Ilist) { m_msevector.assign(_Ilist); }
+
+			size_type capacity() const _NOEXCEPT { return m_msevector.capacity(); }
+			void shrink_to_fit() { m_msevector.shrink_to_fit(); }
+			size_type size() const _NOEXCEPT { return m_msevector.size(); }
+			size_type max_size() const _NOEXCEPT { return m_msevector.max_size(); }
+			bool empty() const _NOEXCEPT { return m_msevector.empty(); }
+			_A get_allocator() const _NOEXCEPT { return m_msevector.get_allocator(); }
+			typename _MV::const_reference at(size_type _Pos) const { return m_msevector.at(_Pos); }
+			typename _MV::reference at(size_type _Pos) { return m_msevector.at(_Pos); }
+			typename _MV::reference front() { return m_msevector.front(); }
+			typename _MV::const_reference front() const { return m_msevector.front(); }
+			typename _MV::reference back() { return m_msevector.back(); }
+			typename _MV::const_reference back() const { return m_msevector.back(); }
 
 			/* Try to avoid using these whenever possible. */
 			value_type *data() _NOEXCEPT {
-				return m_shptr->data();
+				return m_msevector.data();
 			}
 			const value_type *data() const _NOEXCEPT {
-				return m_shptr->data();
+				return m_msevector.data();
 			}
 
+			/* Element handles are "registered" pointers to elements that are tracked by the container (so that the elements
+			themselves don't need to be TRegisteredObj<>s). See msevector::element_handle. */
+			typedef typename _MV::element_handle element_handle;
+			typedef typename _MV::const_element_handle const_element_handle;
+			element_handle make_element_handle(size_type index) { return m_msevector.make_element_handle(index); }
+			const_element_handle make_element_handle(size_type index) const { return m_msevector.make_element_handle(index); }
+			const_element_handle make_const_element_handle(size_type index) const { return m_msevector.make_const_element_handle(index); }
+
 			typedef Tvector_xscope_const_iterator<_Ty, _A> xscope_const_iterator;
 			typedef Tvector_xscope_iterator<_Ty, _A> xscope_iterator;
 
@@ -366,12 +431,12 @@ namespace mse {
 				MSE_INHERITED_RANDOM_ACCESS_ITERATOR_MEMBER_TYPE_DECLARATIONS(base_class);
 
 				const_iterator() {}
-				const_iterator(const const_iterator& src_cref) : m_msevector_cshptr(src_cref.m_msevector_cshptr) {
+				const_iterator(const const_iterator& src_cref) : m_liveness_flag_ref(src_cref.m_liveness_flag_ref) {
 					(*this) = src_cref;
 				}
 				~const_iterator() {}
-				const typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() const { return m_ss_const_iterator; }
-				typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() { return m_ss_const_iterator; }
+				const typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() const { assert_target_not_destroyed(); return m_ss_const_iterator; }
+				typename _MV::ss_const_iterator_type& msevector_ss_const_iterator_type() { assert_target_not_destroyed(); return m_ss_const_iterator; }
 				const typename _MV::ss_const_iterator_type& mvssci() const { return msevector_ss_const_iterator_type(); }
 				typename _MV::ss_const_iterator_type& mvssci() { return msevector_ss_const_iterator_type(); }
 
@@ -398,36 +463,44 @@ namespace mse {
 				const_iterator& operator -=(difference_type n) { msevector_ss_const_iterator_type().operator -=(n); return (*this); }
 				const_iterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
 				const_iterator operator-(difference_type n) const { return ((*this) + (-n)); }
-				typename _MV::difference_type operator-(const const_iterator& _Right_cref) const { return msevector_ss_const_iterator_type() - (_Right_cref.msevector_ss_const_iterator_type()); }
+				typename _MV::difference_type operator-(const const_iterator& _Right_cref) const { return m_ss_const_iterator - (_Right_cref.m_ss_const_iterator); }
 				typename _MV::const_reference operator*() const {
-					(*m_msevector_cshptr).assert_parent_not_destroyed();
 					return msevector_ss_const_iterator_type().operator*();
 				}
 				typename _MV::const_reference item() const { return operator*(); }
 				typename _MV::const_reference previous_item() const { return msevector_ss_const_iterator_type().previous_item(); }
 				typename _MV::const_pointer operator->() const {
-					(*m_msevector_cshptr).assert_parent_not_destroyed();
 					return msevector_ss_const_iterator_type().operator->();
 				}
 				typename _MV::const_reference operator[](typename _MV::difference_type _Off) const { return (*(*this + _Off)); }
-				bool operator==(const const_iterator& _Right_cref) const { return msevector_ss_const_iterator_type().operator==(_Right_cref.msevector_ss_const_iterator_type()); }
+				/* Comparisons involve only the iterators' container pointers and indexes (not the containers themselves), so they
+				don't need to verify that the target vector still exists. */
+				bool operator==(const const_iterator& _Right_cref) const { return m_ss_const_iterator.operator==(_Right_cref.m_ss_const_iterator); }
 				bool operator!=(const const_iterator& _Right_cref) const { return (!(_Right_cref == (*this))); }
-				bool operator<(const const_iterator& _Right) const { return (msevector_ss_const_iterator_type() < _Right.msevector_ss_const_iterator_type()); }
-				bool operator<=(const const_iterator& _Right) const { return (msevector_ss_const_iterator_type() <= _Right.msevector_ss_const_iterator_type()); }
-				bool operator>(const const_iterator& _Right) const { return (msevector_ss_const_iterator_type() > _Right.msevector_ss_const_iterator_type()); }
-				bool operator>=(const const_iterator& _Right) const { return (msevector_ss_const_iterator_type() >= _Right.msevector_ss_const_iterator_type()); }
+				bool operator<(const const_iterator& _Right) const { return (m_ss_const_iterator < _Right.m_ss_const_iterator); }
+				bool operator<=(const const_iterator& _Right) const { return (m_ss_const_iterator <= _Right.m_ss_const_iterator); }
+				bool operator>(const const_iterator& _Right) const { return (m_ss_const_iterator > _Right.m_ss_const_iterator); }
+				bool operator>=(const const_iterator& _Right) const { return (m_ss_const_iterator >= _Right.m_ss_const_iterator); }
 				void set_to_const_item_pointer(const const_iterator& _Right_cref) { msevector_ss_const_iterator_type().set_to_const_item_pointer(_Right_cref.msevector_ss_const_iterator_type()); }
-				msev_size_t position() const { return msevector_ss_const_iterator_type().position(); }
+				msev_size_t position() const { return m_ss_const_iterator.position(); }
 				auto target_container_ptr() const -> decltype(msevector_ss_const_iterator_type().target_container_ptr()) {
 					return msevector_ss_const_iterator_type().target_container_ptr();
 				}
 				void async_not_shareable_and_not_passable_tag() const {}
 			private:
-				const_iterator(std::shared_ptr<_MV> msevector_shptr) : m_msevector_cshptr(msevector_shptr) {
-					m_ss_const_iterator = msevector_shptr->ss_cbegin();
+				void assert_target_not_destroyed() const {
+					if (!m_liveness_flag_ref.target_is_alive()) {
+						/* This can happen if, for example, you dereference an mstd::vector<> iterator after the vector has
+						been destroyed. You can supress this assert by defining MSE_SUPPRESS_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						(in which case just the exception will be thrown). */
+#ifdef MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						assert(false);
+#endif // MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						MSE_THROW(mstdvector_use_after_free_error("attempt to use an iterator whose target vector has been destroyed - mse::mstd::vector"));
+					}
 				}
-				std::shared_ptr<const _MV> m_msevector_cshptr;
-				/* m_ss_const_iterator needs to be declared after m_msevector_cshptr so that its destructor will be called first. */
+
+				impl::ns_vector::CLivenessFlagRef m_liveness_flag_ref;
 				typename _MV::ss_const_iterator_type m_ss_const_iterator;
 
 				friend class /*_Myt*/vector<_Ty, _A>;
@@ -440,20 +513,18 @@ namespace mse {
 				MSE_INHERITED_RANDOM_ACCESS_ITERATOR_MEMBER_TYPE_DECLARATIONS(base_class);
 
 				iterator() {}
-				iterator(const iterator& src_cref) : m_msevector_shptr(src_cref.m_msevector_shptr) {
+				iterator(const iterator& src_cref) : m_liveness_flag_ref(src_cref.m_liveness_flag_ref) {
 					(*this) = src_cref;
 				}
 				~iterator() {}
-				const typename _MV::ss_iterator_type& msevector_ss_iterator_type() const { return m_ss_iterator; }
-				typename _MV::ss_iterator_type& msevector_ss_iterator_type() { return m_ss_iterator; }
+				const typename _MV::ss_iterator_type& msevector_ss_iterator_type() const { assert_target_not_destroyed(); return m_ss_iterator; }
+				typename _MV::ss_iterator_type& msevector_ss_iterator_type() { assert_target_not_destroyed(); return m_ss_iterator; }
 				const typename _MV::ss_iterator_type& mvssi() const { return msevector_ss_iterator_type(); }
 				typename _MV::ss_iterator_type& mvssi() { return msevector_ss_iterator_type(); }
 				operator const_iterator() const {
-					const_iterator retval(m_msevector_shptr);
-					if (m_msevector_shptr) {
-						retval.msevector_ss_const_iterator_type().set_to_beginning();
-						retval.msevector_ss_const_iterator_type().advance(msev_int(msevector_ss_iterator_type().position()));
-					}
+					const_iterator retval;
+					retval.m_liveness_flag_ref = m_liveness_flag_ref;
+					retval.m_ss_const_iterator = msevector_ss_iterator_type();
 					return retval;
 				}
 
@@ -480,33 +551,44 @@ namespace mse {
 				iterator& operator -=(difference_type n) { msevector_ss_iterator_type().operator -=(n); return (*this); }
 				iterator operator+(difference_type n) const { auto retval = (*this); retval += n; return retval; }
 				iterator operator-(difference_type n) const { return ((*this) + (-n)); }
-				typename _MV::difference_type operator-(const iterator& _Right_cref) const { return msevector_ss_iterator_type() - (_Right_cref.msevector_ss_iterator_type()); }
+				typename _MV::difference_type operator-(const iterator& _Right_cref) const { return m_ss_iterator - (_Right_cref.m_ss_iterator); }
 				typename _MV::reference operator*() const {
-					(*m_msevector_shptr).assert_parent_not_destroyed();
 					return msevector_ss_iterator_type().operator*();
 				}
 				typename _MV::reference item() const { return operator*(); }
 				typename _MV::reference previous_item() const { return msevector_ss_iterator_type().previous_item(); }
 				typename _MV::pointer operator->() const {
-					(*m_msevector_shptr).assert_parent_not_destroyed();
 					return msevector_ss_iterator_type().operator->();
 				}
 				typename _MV::reference operator[](typename _MV::difference_type _Off) const { return (*(*this + _Off)); }
-				bool operator==(const iterator& _Right_cref) const { return msevector_ss_iterator_type().operator==(_Right_cref.msevector_ss_iterator_type()); }
+				/* Comparisons involve only the iterators' container pointers and indexes (not the containers themselves), so they
+				don't need to verify that the target vector still exists. */
+				bool operator==(const iterator& _Right_cref) const { return m_ss_iterator.operator==(_Right_cref.m_ss_iterator); }
 				bool operator!=(const iterator& _Right_cref) const { return (!(_Right_cref == (*this))); }
-				bool operator<(const iterator& _Right) const { return (msevector_ss_iterator_type() < _Right.msevector_ss_iterator_type()); }
-				bool operator<=(const iterator& _Right) const { return (msevector_ss_iterator_type() <= _Right.msevector_ss_iterator_type()); }
-				bool operator>(const iterator& _Right) const { return (msevector_ss_iterator_type() > _Right.msevector_ss_iterator_type()); }
-				bool operator>=(const iterator& _Right) const { return (msevector_ss_iterator_type() >= _Right.msevector_ss_iterator_type()); }
+				bool operator<(const iterator& _Right) const { return (m_ss_iterator < _Right.m_ss_iterator); }
+				bool operator<=(const iterator& _Right) const { return (m_ss_iterator <= _Right.m_ss_iterator); }
+				bool operator>(const iterator& _Right) const { return (m_ss_iterator > _Right.m_ss_iterator); }
+				bool operator>=(const iterator& _Right) const { return (m_ss_iterator >= _Right.m_ss_iterator); }
 				void set_to_item_pointer(const iterator& _Right_cref) { msevector_ss_iterator_type().set_to_item_pointer(_Right_cref.msevector_ss_iterator_type()); }
-				msev_size_t position() const { return msevector_ss_iterator_type().position(); }
+				msev_size_t position() const { return m_ss_iterator.position(); }
 				auto target_container_ptr() const -> decltype(msevector_ss_iterator_type().target_container_ptr()) {
 					return msevector_ss_iterator_type().target_container_ptr();
 				}
 				void async_not_shareable_and_not_passable_tag() const {}
 			private:
-				std::shared_ptr<_MV> m_msevector_shptr;
-				/* m_ss_iterator needs to be declared after m_msevector_shptr so that its destructor will be called first. */
+				void assert_target_not_destroyed() const {
+					if (!m_liveness_flag_ref.target_is_alive()) {
+						/* This can happen if, for example, you dereference an mstd::vector<> iterator after the vector has
+						been destroyed. You can supress this assert by defining MSE_SUPPRESS_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						(in which case just the exception will be thrown). */
+#ifdef MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						assert(false);
+#endif // MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+						MSE_THROW(mstdvector_use_after_free_error("attempt to use an iterator whose target vector has been destroyed - mse::mstd::vector"));
+					}
+				}
+
+				impl::ns_vector::CLivenessFlagRef m_liveness_flag_ref;
 				typename _MV::ss_iterator_type m_ss_iterator;
 
 				friend class /*_Myt*/vector<_Ty, _A>;
@@ -515,33 +597,33 @@ namespace mse {
 			};
 
 			iterator begin() {	// return iterator for beginning of mutable sequence
-				iterator retval; retval.m_msevector_shptr = this->m_shptr;
-				(retval.m_ss_iterator) = m_shptr->ss_begin();
+				iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_iterator) = m_msevector.ss_begin();
 				return retval;
 			}
 			const_iterator begin() const {	// return iterator for beginning of nonmutable sequence
-				const_iterator retval; retval.m_msevector_cshptr = this->m_shptr;
-				(retval.m_ss_const_iterator) = m_shptr->ss_begin();
+				const_iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_const_iterator) = m_msevector.ss_begin();
 				return retval;
 			}
 			iterator end() {	// return iterator for end of mutable sequence
-				iterator retval; retval.m_msevector_shptr = this->m_shptr;
-				(retval.m_ss_iterator) = m_shptr->ss_end();
+				iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_iterator) = m_msevector.ss_end();
 				return retval;
 			}
 			const_iterator end() const {	// return iterator for end of nonmutable sequence
-				const_iterator retval; retval.m_msevector_cshptr = this->m_shptr;
-				(retval.m_ss_const_iterator) = m_shptr->ss_end();
+				const_iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_const_iterator) = m_msevector.ss_end();
 				return retval;
 			}
 			const_iterator cbegin() const {	// return iterator for beginning of nonmutable sequence
-				const_iterator retval; retval.m_msevector_cshptr = this->m_shptr;
-				(retval.m_ss_const_iterator) = m_shptr->ss_cbegin();
+				const_iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_const_iterator) = m_msevector.ss_cbegin();
 				return retval;
 			}
 			const_iterator cend() const {	// return iterator for end of nonmutable sequence
-				const_iterator retval; retval.m_msevector_cshptr = this->m_shptr;
-				(retval.m_ss_const_iterator) = m_shptr->ss_cend();
+				const_iterator retval; retval.m_liveness_flag_ref = liveness_flag_ref();
+				(retval.m_ss_const_iterator) = m_msevector.ss_cend();
 				return retval;
 			}
 
@@ -569,20 +651,20 @@ namespace mse {
 
 
 			vector(const const_iterator &start, const const_iterator &end, const _A& _Al = _A())
-				: m_shptr(std::make_shared<_MV>(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type(), _Al)) {}
+				: m_msevector(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type(), _Al) {}
 			void assign(const const_iterator &start, const const_iterator &end) {
-				m_shptr->assign(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type());
+				m_msevector.assign(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type());
 			}
 			void assign_inclusive(const const_iterator &first, const const_iterator &last) {
-				m_shptr->assign_inclusive(first.msevector_ss_const_iterator_type(), last.msevector_ss_const_iterator_type());
+				m_msevector.assign_inclusive(first.msevector_ss_const_iterator_type(), last.msevector_ss_const_iterator_type());
 			}
 			iterator insert_before(const const_iterator &pos, size_type _M, const _Ty& _X) {
-				auto res = m_shptr->insert_before(pos.msevector_ss_const_iterator_type(), _M, _X);
+				auto res = m_msevector.insert_before(pos.msevector_ss_const_iterator_type(), _M, _X);
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
 			iterator insert_before(const const_iterator &pos, _Ty&& _X) {
-				auto res = m_shptr->insert_before(pos.msevector_ss_const_iterator_type(), std::forward<decltype(_X)>(_X));
+				auto res = m_msevector.insert_before(pos.msevector_ss_const_iterator_type(), std::forward<decltype(_X)>(_X));
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
@@ -591,7 +673,7 @@ namespace mse {
 				//>typename std::enable_if<mse::impl::_mse_Is_iterator<_Iter>::value, typename base_class::iterator>::type
 				, class = mse::impl::_mse_RequireInputIter<_Iter> >
 				iterator insert_before(const const_iterator &pos, const _Iter &start, const _Iter &end) {
-				auto res = m_shptr->insert_before(pos.msevector_ss_const_iterator_type(), start, end);
+				auto res = m_msevector.insert_before(pos.msevector_ss_const_iterator_type(), start, end);
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
@@ -603,18 +685,18 @@ namespace mse {
 				return insert_before(pos, first, end);
 			}
 			iterator insert_before(const const_iterator &pos, _XSTD initializer_list<typename _MV::value_type> _Ilist) {	// insert initializer_list
-				auto res = m_shptr->insert_before(pos.msevector_ss_const_iterator_type(), _Ilist);
+				auto res = m_msevector.insert_before(pos.msevector_ss_const_iterator_type(), _Ilist);
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
 			void insert_before(msev_size_t pos, const _Ty& _X = _Ty()) {
-				m_shptr->insert_before(pos, _X);
+				m_msevector.insert_before(pos, _X);
 			}
 			void insert_before(msev_size_t pos, size_type _M, const _Ty& _X) {
-				m_shptr->insert_before(pos, _M, _X);
+				m_msevector.insert_before(pos, _M, _X);
 			}
 			void insert_before(msev_size_t pos, _XSTD initializer_list<typename _MV::value_type> _Ilist) {	// insert initializer_list
-				m_shptr->insert_before(pos, _Ilist);
+				m_msevector.insert_before(pos, _Ilist);
 			}
 			/* These insert() functions are just aliases for their corresponding insert_before() functions. */
 			iterator insert(const const_iterator &pos, size_type _M, const _Ty& _X) { return insert_before(pos, _M, _X); }
@@ -628,17 +710,17 @@ namespace mse {
 			iterator insert(const const_iterator &pos, _XSTD initializer_list<typename _MV::value_type> _Ilist) { return insert_before(pos, _Ilist); }
 			template<class ..._Valty>
 			iterator emplace(const const_iterator &pos, _Valty&& ..._Val) {
-				auto res = m_shptr->emplace(pos.msevector_ss_const_iterator_type(), std::forward<_Valty>(_Val)...);
+				auto res = m_msevector.emplace(pos.msevector_ss_const_iterator_type(), std::forward<_Valty>(_Val)...);
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
 			iterator erase(const const_iterator &pos) {
-				auto res = m_shptr->erase(pos.msevector_ss_const_iterator_type());
+				auto res = m_msevector.erase(pos.msevector_ss_const_iterator_type());
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
 			iterator erase(const const_iterator &start, const const_iterator &end) {
-				auto res = m_shptr->erase(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type());
+				auto res = m_msevector.erase(start.msevector_ss_const_iterator_type(), end.msevector_ss_const_iterator_type());
 				iterator retval = begin(); retval.msevector_ss_iterator_type() = res;
 				return retval;
 			}
@@ -647,10 +729,10 @@ namespace mse {
 				return erase_inclusive(first, end);
 			}
 			bool operator==(const _Myt& _Right) const {	// test for vector equality
-				return ((*(_Right.m_shptr)) == (*m_shptr));
+				return (_Right.m_msevector == m_msevector);
 			}
 			bool operator<(const _Myt& _Right) const {	// test if _Left < _Right for vectors
-				return ((*m_shptr) < (*(_Right.m_shptr)));
+				return (m_msevector < _Right.m_msevector);
 			}
 
 			void async_not_shareable_tag() const {}
@@ -660,12 +742,30 @@ namespace mse {
 			void async_passable_tag() const {}
 
 		private:
-			const _MV& msevector() const { return (*m_shptr); }
-			auto&& msevector() { return (*m_shptr); }
+			const _MV& msevector() const { return m_msevector; }
+			auto&& msevector() { return m_msevector; }
 			template<class _TThisPointer>
 			static auto& s_msevector(const _TThisPointer& this_pointer) { return this_pointer->msevector(); }
 
-			std::shared_ptr<_MV> m_shptr;
+			impl::ns_vector::CLivenessFlagRef liveness_flag_ref() const {
+				auto liveness_flag_ptr = m_liveness_flag_ptr.load(std::memory_order_acquire);
+				if (!liveness_flag_ptr) {
+					/* The flag is allocated lazily. (Concurrent const access is allowed, so we need to handle a race.) */
+					auto new_liveness_flag_ptr = new impl::ns_vector::CLivenessFlag();
+					if (m_liveness_flag_ptr.compare_exchange_strong(liveness_flag_ptr, new_liveness_flag_ptr, std::memory_order_acq_rel)) {
+						liveness_flag_ptr = new_liveness_flag_ptr;
+					}
+					else {
+						new_liveness_flag_ptr->release();
+					}
+				}
+				liveness_flag_ptr->add_ref();
+				return impl::ns_vector::CLivenessFlagRef(liveness_flag_ptr);
+			}
+
+			_MV m_msevector;
+			/* Each vector owns one reference to its liveness flag (if one has been allocated). */
+			mutable std::atomic<impl::ns_vector::CLivenessFlag*> m_liveness_flag_ptr{ nullptr };
 
 			friend xscope_const_iterator;
 			friend xscope_iterator;
@@ -707,10 +807,10 @@ namespace mse {
 				using base_class::base_class;
 
 				xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<vector<_Ty, _A> >& owner_ptr)
-					: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+					: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to((*owner_ptr).m_msevector)) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 				xscope_structure_lock_guard(const mse::TXScopeFixedPointer<vector<_Ty, _A> >& owner_ptr)
-					: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to(*((*owner_ptr).m_shptr))) {}
+					: base_class(owner_ptr, mse::us::unsafe_make_xscope_pointer_to((*owner_ptr).m_msevector)) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 
 			private:
@@ -725,10 +825,10 @@ namespace mse {
 				using base_class::base_class;
 
 				xscope_const_structure_lock_guard(const mse::TXScopeObjFixedConstPointer<vector<_Ty, _A> >& owner_ptr)
-					: base_class(owner_ptr, mse::us::unsafe_make_xscope_const_pointer_to(*((*owner_ptr).m_shptr))) {}
+					: base_class(owner_ptr, mse::us::unsafe_make_xscope_const_pointer_to((*owner_ptr).m_msevector)) {}
 #if !defined(MSE_SCOPEPOINTER_DISABLED)
 				xscope_const_structure_lock_guard(const mse::TXScopeFixedConstPointer<vector<_Ty, _A> >& owner_ptr)
-					: base_class(owner_ptr, mse::us::unsafe_make_xscope_const_pointer_to(*((*owner_ptr).m_shptr))) {}
+					: base_class(owner_ptr, mse::us::unsafe_make_xscope_const_pointer_to((*owner_ptr).m_msevector)) {}
 #endif // !defined(MSE_SCOPEPOINTER_DISABLED)
 
 			private:
@@ -812,6 +912,14 @@ namespace mse {
 		/* Overloads for rsv::TReturnableFParam<>. */
 		MSE_OVERLOAD_FOR_RETURNABLE_FPARAM_DECLARATION(make_xscope_structure_lock_guard)
 	}
+
+#ifdef MSE_HAS_MEMORY_RESOURCE
+	namespace pmr {
+		/* mstd::vector<> using std::pmr::polymorphic_allocator<>, analogous to std::pmr::vector<>. */
+		template<class _Ty>
+		using vector = mse::mstd::vector<_Ty, std::pmr::polymorphic_allocator<_Ty> >;
+	}
+#endif // MSE_HAS_MEMORY_RESOURCE
 }
 
 #ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
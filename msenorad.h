@@ -21,6 +21,7 @@ objects of a given type. */
 #include <utility>
 #include <unordered_map>
 #include <mutex>
+#include <atomic>
 #include <cassert>
 //include <typeinfo>      // std::bad_cast
 #include <stdexcept>
@@ -46,6 +47,14 @@ objects of a given type. */
 #define _NOEXCEPT
 #endif /*_NOEXCEPT*/
 
+/* Declares the async_shareable_and_passable_tag() member on norad pointer types whose target type and reference counter
+qualify (see is_async_shareable_norad_target<>). The tag isn't detected through base classes, so each pointer type declares
+its own. */
+#define MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG \
+	template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) \
+		&& (mse::us::impl::is_async_shareable_norad_target<_Ty2, _TRefCounter>::value), void>::type> \
+	void async_shareable_and_passable_tag() const {}
+
 namespace mse {
 	namespace us {
 		namespace impl {
@@ -56,8 +65,44 @@ namespace mse {
 			template<typename _Ty, typename _TRefCounter = int> class TGNoradNotNullConstPointer;
 			template<typename _Ty, typename _TRefCounter = int> class TGNoradFixedPointer;
 			template<typename _Ty, typename _TRefCounter = int> class TGNoradFixedConstPointer;
+
+			/* A reference counter (for use with TGNoradObj<>) that can be safely modified from multiple threads. The count is
+			only used to verify that no references are outstanding when the target object is destroyed, so increments can use
+			relaxed memory ordering. */
+			class CNoradAtomicRefCounter {
+			public:
+				CNoradAtomicRefCounter(int i = 0) : m_counter(i) {}
+				/* The reference count is not a property of the value of the (target) object, so it isn't copied. */
+				CNoradAtomicRefCounter(const CNoradAtomicRefCounter&) : m_counter(0) {}
+				CNoradAtomicRefCounter& operator+=(int i) { m_counter.fetch_add(i, std::memory_order_relaxed); return (*this); }
+				CNoradAtomicRefCounter& operator-=(int i) { m_counter.fetch_sub(i, std::memory_order_acq_rel); return (*this); }
+				operator int() const { return m_counter.load(std::memory_order_acquire); }
+			private:
+				std::atomic<int> m_counter;
+			};
+
+			/* Indicates whether a reference counter type can be safely modified from multiple threads. Specialize this for any
+			user supplied thread safe counter type. */
+			template<typename _TRefCounter> struct is_thread_safe_norad_ref_counter : std::false_type {};
+			template<> struct is_thread_safe_norad_ref_counter<CNoradAtomicRefCounter> : std::true_type {};
+
+			/* Norad pointers are safe to pass to (and share with) other threads if their reference counter is thread safe and
+			their target type is "marked" as safe to share among threads. */
+			template<typename _Ty, typename _TRefCounter> struct is_async_shareable_norad_target : std::integral_constant<bool,
+				(is_thread_safe_norad_ref_counter<_TRefCounter>::value) && (mse::impl::is_marked_as_shareable_msemsearray<_Ty>::value)> {};
 		}
 	}
+
+	/* TAsyncNoradPointer<> is a version of TNoradPointer<> that uses an atomic reference counter. So (unlike TNoradPointer<>) it
+	can be passed to, and shared with, other threads, as long as its target type is safe to share (i.e. is "marked" as
+	shareable). */
+	template<typename _Ty> using TAsyncNoradObj = us::impl::TGNoradObj<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradPointer = us::impl::TGNoradPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradConstPointer = us::impl::TGNoradConstPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradNotNullPointer = us::impl::TGNoradNotNullPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradNotNullConstPointer = us::impl::TGNoradNotNullConstPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradFixedPointer = us::impl::TGNoradFixedPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
+	template<typename _Ty> using TAsyncNoradFixedConstPointer = us::impl::TGNoradFixedConstPointer<_Ty, us::impl::CNoradAtomicRefCounter>;
 	
 #ifndef MSE_DO_NOT_DEFINE_NDNORAD_AS_ALIAS
 
@@ -102,6 +147,9 @@ namespace mse {
 		template <class _Ty> void ndnorad_delete(TNDNoradPointer<_Ty>& ndnoradPtrRef);
 		template <class _Ty> void ndnorad_delete(TNDNoradConstPointer<_Ty>& ndnoradPtrRef);
 	}
+	template <class _Ty, class... Args> TNDNoradPointer<_Ty> ndnorad_new_pooled(Args&&... args);
+	template <class _Ty> void ndnorad_delete_pooled(TNDNoradPointer<_Ty>& ndnoradPtrRef);
+	template <class _Ty> void ndnorad_delete_pooled(TNDNoradConstPointer<_Ty>& ndnoradPtrRef);
 
 	namespace impl {
 		template<typename _Ty, class... Args>
@@ -168,6 +216,12 @@ namespace mse {
 			mse::norad_delete(regPtrRef);
 		}
 	}
+	template <class _Ty, class... Args>
+	TNoradPointer<_Ty> norad_new_pooled(Args&&... args) { return norad_new<_Ty>(std::forward<Args>(args)...); }
+	template <class _Ty>
+	void norad_delete_pooled(TNoradPointer<_Ty>& regPtrRef) { norad_delete<_Ty>(regPtrRef); }
+	template <class _Ty>
+	void norad_delete_pooled(TNoradConstPointer<_Ty>& regPtrRef) { norad_delete<_Ty>(regPtrRef); }
 
 	template <class X, class... Args>
 	auto make_norad(Args&&... args) {
@@ -210,6 +264,9 @@ namespace mse {
 		template <class _Ty> void norad_delete(TNDNoradPointer<_Ty>& ndnoradPtrRef) { return mse::us::ndnorad_delete<_Ty>(ndnoradPtrRef); }
 		template <class _Ty> void norad_delete(TNDNoradConstPointer<_Ty>& ndnoradPtrRef) { return mse::us::ndnorad_delete<_Ty>(ndnoradPtrRef); }
 	}
+	template <class _Ty, class... Args> TNDNoradPointer<_Ty> norad_new_pooled(Args&&... args) { return ndnorad_new_pooled<_Ty>(std::forward<Args>(args)...); }
+	template <class _Ty> void norad_delete_pooled(TNDNoradPointer<_Ty>& ndnoradPtrRef) { return mse::ndnorad_delete_pooled<_Ty>(ndnoradPtrRef); }
+	template <class _Ty> void norad_delete_pooled(TNDNoradConstPointer<_Ty>& ndnoradPtrRef) { return mse::ndnorad_delete_pooled<_Ty>(ndnoradPtrRef); }
 
 	template <class X, class... Args>
 	auto make_norad(Args&&... args) {
@@ -306,6 +363,10 @@ namespace mse {
 					delete a;
 				}
 
+				/* If the reference counter is thread safe and the target type is "marked" as safe to share among threads, then
+				the pointer is safe to pass to (and share with) other threads. */
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
+
 			private:
 				TGNoradPointer(TGNoradObj<_Ty, _TRefCounter>* ptr) : m_ptr(ptr) {
 					assert(m_ptr);
@@ -417,6 +478,8 @@ namespace mse {
 					delete a;
 				}
 
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
+
 			private:
 				TGNoradConstPointer(const TGNoradObj<_Ty, _TRefCounter>* ptr) : m_ptr(ptr) {
 					assert(m_ptr);
@@ -451,6 +514,8 @@ namespace mse {
 				TGNoradNotNullPointer(TGNoradNotNullPointer&& src_ref) : TGNoradPointer<_Ty, _TRefCounter>(std::forward<decltype(src_ref)>(src_ref)) {}
 
 				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TGNoradNotNullPointer() {}
+
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
 				/*
 				TGNoradNotNullPointer<_Ty, _TRefCounter>& operator=(const TGNoradNotNullPointer<_Ty, _TRefCounter>& _Right_cref) {
 				TGNoradPointer<_Ty, _TRefCounter>::operator=(_Right_cref);
@@ -510,6 +575,8 @@ namespace mse {
 
 				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TGNoradNotNullConstPointer() {}
 
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
+
 				const TGNoradObj<_Ty, _TRefCounter>& operator*() const {
 					//if (!((*this).m_ptr)) { MSE_THROW(primitives_null_dereference_error("attempt to dereference null pointer - mse::TNoradPointer")); }
 					return *((*this).m_ptr);
@@ -576,6 +643,8 @@ namespace mse {
 
 				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TGNoradFixedPointer() {}
 
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
+
 				/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
 				MSE_DEPRECATED explicit operator _Ty*() const { return TGNoradNotNullPointer<_Ty, _TRefCounter>::operator _Ty*(); }
 				MSE_DEPRECATED explicit operator TGNoradObj<_Ty, _TRefCounter>*() const { return TGNoradNotNullPointer<_Ty, _TRefCounter>::operator TGNoradObj<_Ty, _TRefCounter>*(); }
@@ -618,6 +687,8 @@ namespace mse {
 				TGNoradFixedConstPointer(TGNoradNotNullConstPointer<_Ty, _TRefCounter>&& src_ref) : TGNoradNotNullConstPointer<_Ty, _TRefCounter>(std::forward<decltype(src_ref)>(src_ref)) {}
 
 				MSE_IMPL_DESTRUCTOR_PREFIX1 ~TGNoradFixedConstPointer() {}
+
+				MSE_IMPL_NORAD_ASYNC_SHAREABLE_AND_PASSABLE_TAG
 				/* This native pointer cast operator is just for compatibility with existing/legacy code and ideally should never be used. */
 				MSE_DEPRECATED explicit operator const _Ty*() const { return TGNoradNotNullConstPointer<_Ty, _TRefCounter>::operator const _Ty*(); }
 				MSE_DEPRECATED explicit operator const TGNoradObj<_Ty, _TRefCounter>*() const { return TGNoradNotNullConstPointer<_Ty, _TRefCounter>::operator const TGNoradObj<_Ty, _TRefCounter>*(); }
@@ -713,6 +784,31 @@ namespace mse {
 		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::ndnorad_delete() \n- tip: If deleting via base class pointer, use mse::us::ndnorad_delete() instead. ")); }
 		ndnoradPtrRef.norad_delete();
 	}
+
+	/* See ndregistered_new_pooled(). */
+	template <class _Ty, class... Args>
+	TNDNoradPointer<_Ty> ndnorad_new_pooled(Args&&... args) {
+		auto a = mse::us::impl::pooled_new<TNDNoradObj<_Ty> >(std::forward<Args>(args)...);
+		mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDNoradObj<_Ty> > >().registerPointer(a);
+		return &(*a);
+	}
+	template <class _Ty>
+	void ndnorad_delete_pooled(TNDNoradPointer<_Ty>& ndnoradPtrRef) {
+		auto a = static_cast<TNDNoradObj<_Ty>*>(std::addressof(*ndnoradPtrRef));
+		auto res = mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDNoradObj<_Ty> > >().unregisterPointer(a);
+		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::ndnorad_delete_pooled() \n- tip: Objects allocated with norad_new_pooled() must be deallocated with norad_delete_pooled() and vice versa. ")); }
+		ndnoradPtrRef = nullptr;
+		/* The destructor will terminate the program if any other norad pointers are still targeting the object. */
+		mse::us::impl::pooled_delete(a);
+	}
+	template <class _Ty>
+	void ndnorad_delete_pooled(TNDNoradConstPointer<_Ty>& ndnoradPtrRef) {
+		auto a = static_cast<const TNDNoradObj<_Ty>*>(std::addressof(*ndnoradPtrRef));
+		auto res = mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDNoradObj<_Ty> > >().unregisterPointer(a);
+		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::ndnorad_delete_pooled() \n- tip: Objects allocated with norad_new_pooled() must be deallocated with norad_delete_pooled() and vice versa. ")); }
+		ndnoradPtrRef = nullptr;
+		mse::us::impl::pooled_delete(a);
+	}
 	namespace us {
 		template <class _Ty>
 		void ndnorad_delete(TNDNoradPointer<_Ty>& ndnoradPtrRef) {
@@ -231,10 +231,84 @@ namespace mse {
 		MSE_USING(non_thread_safe_shared_mutex, base_class);
 	};
 
+	/* atomic_state_shared_mutex is a version of T_shared_mutex<> whose state (the "exclusive lock" indicator and the shared
+	lock count) is packed into a single atomic word. Like T_shared_mutex<>, it never blocks. Attempting to acquire an
+	unavailable lock results in an exception (or a false return value for the try_lock*() functions).
+	It is intended for use as the "structure lock" of containers that may be shared among threads. Such containers can
+	only be modified (and thus have their structure changed) by a thread with exclusive access to the container, so only
+	the shared (read) locks are expected to be acquired concurrently. Acquiring an exclusive lock or (in the uncontended
+	case) a shared lock is a single compare-exchange, releasing an exclusive lock is a plain (atomic) store, and releasing
+	a shared lock is a single fetch-and-subtract. */
+	class atomic_state_shared_mutex {
+	public:
+		atomic_state_shared_mutex() {}
+		void lock() {	// lock exclusive
+			if (!try_lock()) {
+				MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
+			}
+		}
+		bool try_lock() {	// try to lock exclusive
+			/* A single compare-exchange, so that a concurrent try_lock_shared() can't slip in between checking for
+			and setting the exclusive lock. (Measured in an optimized x86-64 build, this makes an uncontended
+			try_lock()/unlock() pair roughly 9 times slower than a separate load and store, and mtnii_vector<>'s
+			push_back() roughly 1.7 times slower.) */
+			size_t expected_state = 0;
+			return m_state.compare_exchange_strong(expected_state, exclusive_lock_flag, std::memory_order_acquire, std::memory_order_relaxed);
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {	// try to lock for duration
+			return (try_lock_until(std::chrono::steady_clock::now() + _Rel_time));
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_until(const std::chrono::time_point<_Clock, _Duration>& /*_Abs_time*/) {	// try to lock until time point
+			return try_lock();
+		}
+		void unlock() {	// unlock exclusive
+			/* While the exclusive lock is held, no shared lock can be acquired, so the state can simply be reset. */
+			assert(exclusive_lock_flag == m_state.load(std::memory_order_relaxed));
+			m_state.store(0, std::memory_order_release);
+		}
+		void lock_shared() {	// lock non-exclusive
+			if (!try_lock_shared()) {
+				MSE_THROW(std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur)));
+			}
+		}
+		bool try_lock_shared() {	// try to lock non-exclusive
+			auto state = m_state.load(std::memory_order_relaxed);
+			do {
+				if (exclusive_lock_flag & state) {
+					return false;
+				}
+			} while (!m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed));
+			return true;
+		}
+		template<class _Rep, class _Period>
+		bool try_lock_shared_for(const std::chrono::duration<_Rep, _Period>& _Rel_time) {	// try to lock non-exclusive for relative time
+			return (try_lock_shared_until(_Rel_time + std::chrono::steady_clock::now()));
+		}
+		template<class _Clock, class _Duration>
+		bool try_lock_shared_until(const std::chrono::time_point<_Clock, _Duration>& /*_Abs_time*/) {	// try to lock non-exclusive until absolute time
+			return try_lock_shared();
+		}
+		void unlock_shared() {	// unlock non-exclusive
+			auto previous_state = m_state.fetch_sub(1, std::memory_order_release);
+			assert((1 <= previous_state) && (!(exclusive_lock_flag & previous_state)));
+			(void)previous_state;
+		}
+
+		atomic_state_shared_mutex(const atomic_state_shared_mutex&) = delete;
+		atomic_state_shared_mutex& operator=(const atomic_state_shared_mutex&) = delete;
+
+	private:
+		/* The highest bit of the state indicates an exclusive lock, the remaining bits hold the shared lock count. */
+		static constexpr size_t exclusive_lock_flag = size_t(1) << (8 * sizeof(size_t) - 1);
+		std::atomic<size_t> m_state = { 0 };
+	};
+
 	/* The library's dynamic containers have a mutex used to "lock their structure". Containers that might be shared
 	among threads need the mutex to be (at least partially) thread-safe. Specifically, the "read lock" needs to be
 	atomic. */
-	typedef T_shared_mutex<bool, std::atomic<size_t> > shareable_dynamic_container_mutex;
+	typedef atomic_state_shared_mutex shareable_dynamic_container_mutex;
 
 	class non_thread_safe_recursive_shared_timed_mutex : public non_thread_safe_shared_mutex {
 	public:
@@ -15,6 +15,20 @@
 #include <memory>
 #include <unordered_set>
 #include <functional>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <atomic>
+#include <thread>
+
+#ifdef MSE_SALLOC_REGISTRY_STATS
+#include <ostream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <mutex>
+#include <typeinfo>
+#endif // MSE_SALLOC_REGISTRY_STATS
 
 #ifndef MSEPRIMITIVES_H
 
@@ -63,6 +77,14 @@
 
 #endif /*ndef MSEPRIMITIVES_H*/
 
+#if defined(MSE_HAS_CXX17) && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+/* The library's containers have "pmr" versions (in the mse::pmr namespace) that use std::pmr::polymorphic_allocator<>. */
+#define MSE_HAS_MEMORY_RESOURCE
+#endif // __has_include(<memory_resource>)
+#endif // defined(MSE_HAS_CXX17) && defined(__has_include)
+
 #ifdef MSE_SAFER_SUBSTITUTES_DISABLED
 #define MSE_POINTERBASICS_DISABLED
 #define MSE_SAFERPTR_DISABLED
@@ -1663,14 +1685,227 @@ namespace mse {
 #pragma warning( disable : 4127 )
 #endif /*_MSC_VER*/
 
+			/* CPointerSet is a (flat) open addressing hash set of (non-null) pointers. It uses linear probing with "backward
+			shift" deletion (so no "tombstones"), and doesn't allocate any memory on insertion except when it needs to grow
+			its table. */
+			class CPointerSet {
+			public:
+				CPointerSet() {}
+				CPointerSet(const CPointerSet&) = delete;
+				CPointerSet& operator=(const CPointerSet&) = delete;
+
+				bool insert(void* ptr) {
+					assert(nullptr != ptr);
+					reserve(m_size + 1);
+					auto index = home_index(ptr);
+					while (nullptr != m_slots[index]) {
+						if (ptr == m_slots[index]) { return false; }
+						index = (index + 1) & m_mask;
+					}
+					m_slots[index] = ptr;
+					m_size += 1;
+					return true;
+				}
+				size_t erase(void* ptr) {
+					if ((0 == m_size) || (nullptr == ptr)) { return 0; }
+					auto index = home_index(ptr);
+					while (ptr != m_slots[index]) {
+						if (nullptr == m_slots[index]) { return 0; }
+						index = (index + 1) & m_mask;
+					}
+					/* "Backward shift" the subsequent items in the probe sequence (that aren't already in their home slot)
+					into the vacated slot. */
+					auto vacant_index = index;
+					auto next_index = (vacant_index + 1) & m_mask;
+					while (nullptr != m_slots[next_index]) {
+						const auto next_home_index = home_index(m_slots[next_index]);
+						if (((next_index - next_home_index) & m_mask) >= ((next_index - vacant_index) & m_mask)) {
+							m_slots[vacant_index] = m_slots[next_index];
+							vacant_index = next_index;
+						}
+						next_index = (next_index + 1) & m_mask;
+					}
+					m_slots[vacant_index] = nullptr;
+					m_size -= 1;
+					return 1;
+				}
+				/* Ensures that the set can hold the given number of items without reallocating. */
+				void reserve(size_t count) {
+					if (count * sc_max_load_denominator > capacity() * sc_max_load_numerator) {
+						size_t new_capacity = (sc_min_capacity > capacity()) ? sc_min_capacity : capacity();
+						while (count * sc_max_load_denominator > new_capacity * sc_max_load_numerator) {
+							new_capacity *= 2;
+						}
+						rehash(new_capacity);
+					}
+				}
+				size_t size() const { return m_size; }
+				size_t capacity() const { return (nullptr != m_slots) ? (m_mask + 1) : 0; }
+				/* The number of slots that would be examined by a lookup of the given pointer. */
+				size_t probe_length(const void* ptr) const {
+					if (0 == m_size) { return 0; }
+					size_t retval = 1;
+					auto index = home_index(ptr);
+					while ((ptr != m_slots[index]) && (nullptr != m_slots[index])) {
+						index = (index + 1) & m_mask;
+						retval += 1;
+					}
+					return retval;
+				}
+
+			private:
+				size_t home_index(const void* ptr) const {
+					/* Fibonacci hashing. The low bits of the pointer value are discarded as they are likely to be zero due
+					to alignment. */
+					const auto h = size_t(std::uintptr_t(ptr) >> 4) * size_t(0x9E3779B97F4A7C15ull);
+					return (h >> m_shift) & m_mask;
+				}
+				void rehash(size_t new_capacity) {
+					assert(0 == (new_capacity & (new_capacity - 1)));
+					const auto old_capacity = capacity();
+					auto old_slots = std::move(m_slots);
+					m_slots = std::unique_ptr<void*[]>(new void*[new_capacity]());
+					m_mask = new_capacity - 1;
+					int log2_capacity = 0;
+					while ((size_t(1) << log2_capacity) < new_capacity) { log2_capacity += 1; }
+					m_shift = int(sizeof(size_t) * CHAR_BIT) - log2_capacity;
+					if (int(sizeof(size_t) * CHAR_BIT) <= m_shift) { m_shift = 0; }
+					for (size_t i = 0; i < old_capacity; i += 1) {
+						auto ptr = old_slots[i];
+						if (nullptr != ptr) {
+							auto index = home_index(ptr);
+							while (nullptr != m_slots[index]) {
+								index = (index + 1) & m_mask;
+							}
+							m_slots[index] = ptr;
+						}
+					}
+				}
+
+				MSE_CONSTEXPR static const size_t sc_min_capacity = 16;
+				/* maximum load factor of 3/4 */
+				MSE_CONSTEXPR static const size_t sc_max_load_numerator = 3;
+				MSE_CONSTEXPR static const size_t sc_max_load_denominator = 4;
+
+				std::unique_ptr<void*[]> m_slots;
+				size_t m_mask = 0;
+				int m_shift = 0;
+				size_t m_size = 0;
+			};
+
+#ifdef MSE_SALLOC_REGISTRY_STATS
+			/* With MSE_SALLOC_REGISTRY_STATS defined, each CSAllocRegistry collects statistics about its use, which can be
+			used, for example, to tune MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS. See mse::write_salloc_registry_stats(). */
+			class CSAllocRegistryStats {
+			public:
+				size_t m_num_registrations = 0;
+				size_t m_num_live_objects = 0;
+				size_t m_peak_num_live_objects = 0;
+				/* the number of objects moved from "fast storage" to "slow storage" (to make room) */
+				size_t m_num_fs1_spills = 0;
+				size_t m_num_fs1_unregister_hits = 0;
+				size_t m_num_slow_storage_unregister_hits = 0;
+				size_t m_num_unregister_misses = 0;
+				/* the total number of elements examined by (fast and slow storage) lookups on unregistration */
+				size_t m_total_fs1_probe_length = 0;
+				size_t m_total_slow_storage_probe_length = 0;
+
+				void accumulate(const CSAllocRegistryStats& src_cref) {
+					m_num_registrations += src_cref.m_num_registrations;
+					m_num_live_objects += src_cref.m_num_live_objects;
+					if (src_cref.m_peak_num_live_objects > m_peak_num_live_objects) {
+						m_peak_num_live_objects = src_cref.m_peak_num_live_objects;
+					}
+					m_num_fs1_spills += src_cref.m_num_fs1_spills;
+					m_num_fs1_unregister_hits += src_cref.m_num_fs1_unregister_hits;
+					m_num_slow_storage_unregister_hits += src_cref.m_num_slow_storage_unregister_hits;
+					m_num_unregister_misses += src_cref.m_num_unregister_misses;
+					m_total_fs1_probe_length += src_cref.m_total_fs1_probe_length;
+					m_total_slow_storage_probe_length += src_cref.m_total_slow_storage_probe_length;
+				}
+				void write(std::ostream& os, const std::string& type_name) const {
+					const auto num_unregister_hits = m_num_fs1_unregister_hits + m_num_slow_storage_unregister_hits;
+					const auto num_unregistrations = num_unregister_hits + m_num_unregister_misses;
+					os << type_name << ": live: " << m_num_live_objects << ", peak live: " << m_peak_num_live_objects
+						<< ", registrations: " << m_num_registrations << ", fast storage spills: " << m_num_fs1_spills;
+					if (1 <= num_unregister_hits) {
+						os << ", fast storage hit ratio: " << (double(m_num_fs1_unregister_hits) / double(num_unregister_hits));
+					}
+					if (1 <= num_unregistrations) {
+						os << ", avg fast storage probe length: " << (double(m_total_fs1_probe_length) / double(num_unregistrations));
+					}
+					if (1 <= (m_num_slow_storage_unregister_hits + m_num_unregister_misses)) {
+						os << ", avg slow storage probe length: " << (double(m_total_slow_storage_probe_length) / double(m_num_slow_storage_unregister_hits + m_num_unregister_misses));
+					}
+					os << ", unregister misses: " << m_num_unregister_misses << "\n";
+				}
+			};
+
+			/* Statistics of registries whose threads have exited, aggregated by type. */
+			class CSAllocRegistryExitedThreadStats {
+			public:
+				static void accumulate(const std::string& type_name, const CSAllocRegistryStats& stats_cref) {
+					std::lock_guard<std::mutex> lock(mutex_ref());
+					map_ref()[type_name].accumulate(stats_cref);
+				}
+				static void write(std::ostream& os) {
+					std::lock_guard<std::mutex> lock(mutex_ref());
+					for (const auto& item : map_ref()) {
+						item.second.write(os, item.first);
+					}
+				}
+
+			private:
+				static std::map<std::string, CSAllocRegistryStats>& map_ref() {
+					static std::map<std::string, CSAllocRegistryStats> s_map;
+					return s_map;
+				}
+				static std::mutex& mutex_ref() {
+					static std::mutex s_mutex;
+					return s_mutex;
+				}
+			};
+#endif // MSE_SALLOC_REGISTRY_STATS
+
 			/* CSAllocRegistry essentially just maintains a list of all objects allocated by a registered "new" call and not (yet)
 			subsequently deallocated with a corresponding registered delete. */
 			class CSAllocRegistry {
 			public:
+#ifdef MSE_SALLOC_REGISTRY_STATS
+				CSAllocRegistry(const char* type_name = "") : m_type_name(type_name) {
+					/* Add this registry to the (thread_local) list of the thread's registries. */
+					m_next_registry_ptr = tl_registry_list_head_ref();
+					tl_registry_list_head_ref() = this;
+				}
+				~CSAllocRegistry() {
+					auto registry_ptr_ptr = &(tl_registry_list_head_ref());
+					while (*registry_ptr_ptr) {
+						if (this == (*registry_ptr_ptr)) {
+							(*registry_ptr_ptr) = m_next_registry_ptr;
+							break;
+						}
+						registry_ptr_ptr = &((*registry_ptr_ptr)->m_next_registry_ptr);
+					}
+					if (1 <= m_stats.m_num_registrations) {
+#ifdef MSE_SALLOC_REGISTRY_STATS_DUMP_AT_THREAD_EXIT
+						m_stats.write(std::cerr, m_type_name);
+#endif // MSE_SALLOC_REGISTRY_STATS_DUMP_AT_THREAD_EXIT
+						CSAllocRegistryExitedThreadStats::accumulate(m_type_name, m_stats);
+					}
+				}
+#else // MSE_SALLOC_REGISTRY_STATS
 				CSAllocRegistry() {}
 				~CSAllocRegistry() {}
+#endif // MSE_SALLOC_REGISTRY_STATS
 				bool registerPointer(void *alloc_ptr) {
 					if (nullptr == alloc_ptr) { return true; }
+#ifdef MSE_SALLOC_REGISTRY_STATS
+					m_stats.m_num_registrations += 1;
+					m_stats.m_num_live_objects += 1;
+					if (m_stats.m_num_live_objects > m_stats.m_peak_num_live_objects) {
+						m_stats.m_peak_num_live_objects = m_stats.m_num_live_objects;
+					}
+#endif // MSE_SALLOC_REGISTRY_STATS
 					{
 						if (1 <= sc_fs1_max_objects) {
 							/* We'll add this object to fast storage. */
@@ -1685,8 +1920,7 @@ namespace mse {
 						}
 						else {
 							/* Add the mapping to slow storage. */
-							std::unordered_set<CFS1Object>::value_type item(alloc_ptr);
-							m_pointer_set.insert(item);
+							m_pointer_set.insert(alloc_ptr);
 						}
 					}
 					return true;
@@ -1698,17 +1932,35 @@ namespace mse {
 						/* check if the object is in "fast storage 1" first */
 						for (int i = (m_num_fs1_objects - 1); i >= 0; i -= 1) {
 							if (alloc_ptr == m_fs1_objects[i]) {
+#ifdef MSE_SALLOC_REGISTRY_STATS
+								m_stats.m_total_fs1_probe_length += size_t(m_num_fs1_objects - i);
+								m_stats.m_num_fs1_unregister_hits += 1;
+								m_stats.m_num_live_objects -= 1;
+#endif // MSE_SALLOC_REGISTRY_STATS
 								removeObjectFromFastStorage1(i);
 								return true;
 							}
 						}
 
 						/* The object was not in "fast storage 1". It's proably in "slow storage". */
+#ifdef MSE_SALLOC_REGISTRY_STATS
+						m_stats.m_total_fs1_probe_length += size_t(m_num_fs1_objects);
+						m_stats.m_total_slow_storage_probe_length += m_pointer_set.probe_length(alloc_ptr);
+#endif // MSE_SALLOC_REGISTRY_STATS
 						auto num_erased = m_pointer_set.erase(alloc_ptr);
 						if (1 <= num_erased) {
 							retval = true;
 						}
 					}
+#ifdef MSE_SALLOC_REGISTRY_STATS
+					if (retval) {
+						m_stats.m_num_slow_storage_unregister_hits += 1;
+						m_stats.m_num_live_objects -= 1;
+					}
+					else {
+						m_stats.m_num_unregister_misses += 1;
+					}
+#endif // MSE_SALLOC_REGISTRY_STATS
 					return retval;
 				}
 				bool registerPointer(const void *alloc_ptr) { return (*this).registerPointer(const_cast<void *>(alloc_ptr)); }
@@ -1722,6 +1974,18 @@ namespace mse {
 
 				bool isEmpty() const { return ((0 == m_num_fs1_objects) && (0 == m_pointer_set.size())); }
 
+#ifdef MSE_SALLOC_REGISTRY_STATS
+				const CSAllocRegistryStats& stats() const { return m_stats; }
+				const std::string& type_name() const { return m_type_name; }
+
+				/* Writes the statistics of all the (live) registries of the current thread. */
+				static void write_current_thread_stats(std::ostream& os) {
+					for (auto registry_ptr = tl_registry_list_head_ref(); registry_ptr; registry_ptr = registry_ptr->m_next_registry_ptr) {
+						registry_ptr->m_stats.write(os, registry_ptr->m_type_name);
+					}
+				}
+#endif // MSE_SALLOC_REGISTRY_STATS
+
 			private:
 				/* So this tracker stores the allocation pointers in either "fast storage1" or "slow storage". The code for
 				"fast storage1" is ugly. The code for "slow storage" is more readable. */
@@ -1732,9 +1996,11 @@ namespace mse {
 					m_num_fs1_objects -= 1;
 				}
 				void moveObjectFromFastStorage1ToSlowStorage(int fs1_obj_index) {
+#ifdef MSE_SALLOC_REGISTRY_STATS
+					m_stats.m_num_fs1_spills += 1;
+#endif // MSE_SALLOC_REGISTRY_STATS
 					auto& fs1_object_ref = m_fs1_objects[fs1_obj_index];
 					/* First we're gonna copy this object to slow storage. */
-					//std::unordered_set<CFS1Object>::value_type item(fs1_object_ref);
 					m_pointer_set.insert(fs1_object_ref);
 					/* Then we're gonna remove the object from fast storage */
 					removeObjectFromFastStorage1(fs1_obj_index);
@@ -1743,14 +2009,27 @@ namespace mse {
 				typedef void* CFS1Object;
 
 #ifndef MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS
-#define MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS 8/* Arbitrary. The optimal number depends on how slow "slow storage" is. */
+/* The optimal number depends on how slow "slow storage" is. With the (flat) open addressing "slow storage", measurements
+indicate that a small "fast storage" is preferable, as moving objects out of a full "fast storage" isn't free. */
+#define MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS 2
 #endif // !MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS
 				MSE_CONSTEXPR static const int sc_fs1_max_objects = MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS;
 				CFS1Object m_fs1_objects[sc_fs1_max_objects];
 				int m_num_fs1_objects = 0;
 
 				/* "slow storage" */
-				std::unordered_set<CFS1Object> m_pointer_set;
+				CPointerSet m_pointer_set;
+
+#ifdef MSE_SALLOC_REGISTRY_STATS
+				static CSAllocRegistry*& tl_registry_list_head_ref() {
+					thread_local CSAllocRegistry* tl_head_ptr = nullptr;
+					return tl_head_ptr;
+				}
+
+				CSAllocRegistryStats m_stats;
+				std::string m_type_name;
+				CSAllocRegistry* m_next_registry_ptr = nullptr;
+#endif // MSE_SALLOC_REGISTRY_STATS
 			};
 
 #ifdef _MSC_VER
@@ -1759,11 +2038,191 @@ namespace mse {
 
 			template<typename _Ty>
 			inline CSAllocRegistry& tlSAllocRegistry_ref() {
+#ifdef MSE_SALLOC_REGISTRY_STATS
+				thread_local static CSAllocRegistry tlSAllocRegistry(typeid(_Ty).name());
+#else // MSE_SALLOC_REGISTRY_STATS
 				thread_local static CSAllocRegistry tlSAllocRegistry;
+#endif // MSE_SALLOC_REGISTRY_STATS
 				return tlSAllocRegistry;
 			}
 		}
 	}
+
+#ifdef MSE_SALLOC_REGISTRY_STATS
+	/* Writes (per type) statistics of the allocation registries used by registered_new(), cregistered_new(),
+	norad_new(), etc. (Only available when MSE_SALLOC_REGISTRY_STATS is defined.) Includes the registries of the
+	current thread and the aggregated registries of threads that have exited. */
+	inline void write_salloc_registry_stats(std::ostream& os) {
+		os << "allocation registries of the current thread: \n";
+		mse::us::impl::CSAllocRegistry::write_current_thread_stats(os);
+		os << "allocation registries of exited threads: \n";
+		mse::us::impl::CSAllocRegistryExitedThreadStats::write(os);
+	}
+#endif // MSE_SALLOC_REGISTRY_STATS
+
+	namespace us {
+		namespace impl {
+
+			/* CSlabPoolState maintains a (per-thread) pool of fixed-size memory slots allocated in "slabs". Deallocated slots
+			are kept on a free list for reuse rather than being returned to the heap. Each slot has a header (immediately
+			preceding the object) that, while the slot is allocated, points back to its pool, so slots can be deallocated
+			without reference to a thread_local variable (that may have already been destroyed).
+			Only the owning thread (while its handle is alive) uses the (unsynchronized) local free list. Slots deallocated
+			from any other thread, including every deallocation after the owning thread has exited, are pushed onto a
+			lock-free "remote" free list that the owning thread reclaims when its local free list runs out. The owning handle
+			holds one count on the pool, and each allocated slot holds another; whoever releases the last count destroys the
+			pool. */
+			class CSlabPoolState {
+			public:
+				CSlabPoolState(size_t object_size, size_t object_alignment)
+					: m_header_size(round_up(sizeof(CSlotHeader), object_alignment))
+					, m_slot_size(round_up(m_header_size + object_size, (alignof(CSlotHeader) > object_alignment) ? alignof(CSlotHeader) : object_alignment)) {
+					assert(alignof(std::max_align_t) >= object_alignment);
+				}
+				CSlabPoolState(const CSlabPoolState&) = delete;
+				CSlabPoolState& operator=(const CSlabPoolState&) = delete;
+				~CSlabPoolState() {
+					for (auto slab_ptr : m_slab_ptrs) {
+						::operator delete(slab_ptr);
+					}
+				}
+
+				/* To be called (only) from the owning thread. */
+				void* allocate() {
+					if (!m_free_list_head) {
+						m_free_list_head = m_remote_free_list_head.exchange(nullptr, std::memory_order_acquire);
+						if (!m_free_list_head) {
+							add_slab();
+						}
+					}
+					auto header_ptr = m_free_list_head;
+					m_free_list_head = header_ptr->m_next_free_ptr;
+					header_ptr->m_pool_state_ptr = this;
+					m_ref_count.fetch_add(1, std::memory_order_relaxed);
+					return header_ptr + 1;
+				}
+				/* May be called from any thread. */
+				static void deallocate(void* ptr) {
+					if (!ptr) { return; }
+					auto header_ptr = static_cast<CSlotHeader*>(ptr) - 1;
+					auto pool_state_ptr = header_ptr->m_pool_state_ptr;
+					assert(pool_state_ptr);
+					if ((!pool_state_ptr->m_owner_is_gone.load(std::memory_order_acquire))
+						&& (std::this_thread::get_id() == pool_state_ptr->m_owner_thread_id)) {
+						header_ptr->m_next_free_ptr = pool_state_ptr->m_free_list_head;
+						pool_state_ptr->m_free_list_head = header_ptr;
+					}
+					else {
+						auto expected_head_ptr = pool_state_ptr->m_remote_free_list_head.load(std::memory_order_relaxed);
+						do {
+							header_ptr->m_next_free_ptr = expected_head_ptr;
+						} while (!pool_state_ptr->m_remote_free_list_head.compare_exchange_weak(expected_head_ptr, header_ptr
+							, std::memory_order_release, std::memory_order_relaxed));
+					}
+					pool_state_ptr->release_count();
+				}
+				/* To be called (only) by the owning (thread_local) handle upon its destruction. If there are no outstanding
+				allocations the pool is destroyed, otherwise it will be destroyed upon the last deallocation. */
+				void release_owner() {
+					assert(std::this_thread::get_id() == m_owner_thread_id);
+					m_owner_is_gone.store(true, std::memory_order_release);
+					release_count();
+				}
+				size_t num_allocated_slots() const {
+					return m_ref_count.load(std::memory_order_relaxed) - (m_owner_is_gone.load(std::memory_order_relaxed) ? 0 : 1);
+				}
+
+			private:
+				union CSlotHeader {
+					CSlabPoolState* m_pool_state_ptr;
+					CSlotHeader* m_next_free_ptr;
+				};
+				static size_t round_up(size_t size, size_t alignment) {
+					return ((size + alignment - 1) / alignment) * alignment;
+				}
+				void release_count() {
+					const auto prev_count = m_ref_count.fetch_sub(1, std::memory_order_acq_rel);
+					assert(1 <= prev_count);
+					if (1 == prev_count) {
+						delete this;
+					}
+				}
+				void add_slab() {
+					const size_t num_slots = m_next_slab_num_slots;
+					if (sc_max_slab_num_slots > m_next_slab_num_slots) {
+						m_next_slab_num_slots *= 2;
+					}
+					m_slab_ptrs.reserve(m_slab_ptrs.size() + 1);
+					auto slab_ptr = static_cast<char*>(::operator new(num_slots * m_slot_size));
+					m_slab_ptrs.push_back(slab_ptr);
+					for (size_t i = num_slots; 0 < i; i -= 1) {
+						auto header_ptr = reinterpret_cast<CSlotHeader*>(slab_ptr + (i - 1) * m_slot_size + m_header_size) - 1;
+						header_ptr->m_next_free_ptr = m_free_list_head;
+						m_free_list_head = header_ptr;
+					}
+				}
+
+				MSE_CONSTEXPR static const size_t sc_min_slab_num_slots = 16;
+				MSE_CONSTEXPR static const size_t sc_max_slab_num_slots = 1024;
+
+				const size_t m_header_size;
+				const size_t m_slot_size;
+				const std::thread::id m_owner_thread_id = std::this_thread::get_id();
+				CSlotHeader* m_free_list_head = nullptr;
+				std::atomic<CSlotHeader*> m_remote_free_list_head{ nullptr };
+				/* The number of allocated slots, plus one while the owning handle is alive. */
+				std::atomic<size_t> m_ref_count{ 1 };
+				size_t m_next_slab_num_slots = sc_min_slab_num_slots;
+				std::atomic<bool> m_owner_is_gone{ false };
+				std::vector<char*> m_slab_ptrs;
+			};
+
+			/* The thread_local owner of a CSlabPoolState. */
+			class CSlabPoolHandle {
+			public:
+				CSlabPoolHandle(size_t object_size, size_t object_alignment) : m_pool_state_ptr(new CSlabPoolState(object_size, object_alignment)) {}
+				CSlabPoolHandle(const CSlabPoolHandle&) = delete;
+				~CSlabPoolHandle() { m_pool_state_ptr->release_owner(); }
+				CSlabPoolState& state() { return *m_pool_state_ptr; }
+			private:
+				CSlabPoolState* m_pool_state_ptr;
+			};
+
+			template<typename _Ty>
+			inline CSlabPoolState& tlSlabPool_ref() {
+				static_assert(alignof(std::max_align_t) >= alignof(_Ty), "over-aligned types are not supported by the slab pool");
+				thread_local static CSlabPoolHandle tlSlabPoolHandle(sizeof(_Ty), alignof(_Ty));
+				return tlSlabPoolHandle.state();
+			}
+
+			/* Constructs an object in memory drawn from the (thread_local) slab pool for the object's type. */
+			template<typename _Ty, class... Args>
+			_Ty* pooled_new(Args&&... args) {
+				class CAllocationGuard {
+				public:
+					CAllocationGuard(void* ptr) : m_ptr(ptr) {}
+					~CAllocationGuard() { CSlabPoolState::deallocate(m_ptr); }
+					void* m_ptr = nullptr;
+				};
+				CAllocationGuard allocation_guard(tlSlabPool_ref<_Ty>().allocate());
+				auto retval = ::new (allocation_guard.m_ptr) _Ty(std::forward<Args>(args)...);
+				allocation_guard.m_ptr = nullptr;
+				return retval;
+			}
+			/* Destroys an object constructed with pooled_new<>() and returns its memory to its pool. */
+			template<typename _Ty>
+			void pooled_delete(_Ty* ptr) {
+				typedef typename std::remove_const<_Ty>::type non_const_type;
+				auto non_const_ptr = const_cast<non_const_type*>(ptr);
+				if (!non_const_ptr) { return; }
+				non_const_ptr->~non_const_type();
+				CSlabPoolState::deallocate(non_const_ptr);
+			}
+
+			/* Used to distinguish the allocation registries of pooled allocations from those of regular allocations. */
+			template<typename _Ty> class TPooledAllocTag {};
+		}
+	}
 }
 
 #ifdef __clang__
@@ -12,14 +12,17 @@
 #ifndef MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
 #include "msescope.h"
 #endif // !MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
+#include "msepointerbasics.h"
 #include <memory>
 #include <utility>
 #include <cassert>
 #include <stdexcept>
+#include <atomic>
 
 #ifdef MSE_SELF_TESTS
 #include <map>
 #include <string>
+#include <thread>
 #endif // MSE_SELF_TESTS
 
 #ifdef _MSC_VER
@@ -71,6 +74,30 @@ namespace mse {
 		return std::make_shared<X>(std::forward<Args>(args)...);
 	}
 
+	template <class X, class... Args>
+	TRefCountingNotNullPointer<X> make_refcounting_pooled(Args&&... args) {
+		return std::make_shared<X>(std::forward<Args>(args)...);
+	}
+
+	template <class X> using TAtomicRefCountingPointer = std::shared_ptr<X>;
+	template <class X> using TAtomicRefCountingNotNullPointer = std::shared_ptr<X>;
+	template <class X> using TAtomicRefCountingFixedPointer = /*const*/ std::shared_ptr<X>;
+	template <class X> using TAtomicRefCountingConstPointer = std::shared_ptr<const X>;
+	template <class X> using TAtomicRefCountingNotNullConstPointer = std::shared_ptr<const X>;
+	template <class X> using TAtomicRefCountingFixedConstPointer = /*const*/ std::shared_ptr<const X>;
+
+	template <class X, class... Args>
+	TAtomicRefCountingNotNullPointer<X> make_atomic_refcounting(Args&&... args) {
+		return std::make_shared<X>(std::forward<Args>(args)...);
+	}
+
+	template <class X, class... Args>
+	TAtomicRefCountingPointer<X> make_nullable_atomic_refcounting(Args&&... args) {
+		return std::make_shared<X>(std::forward<Args>(args)...);
+	}
+
+	inline void process_pending_atomic_refcounting_releases() {}
+
 #else /*MSE_REFCOUNTINGPOINTER_DISABLED*/
 
 	namespace us {
@@ -98,6 +125,36 @@ namespace mse {
 	template<typename _Ty> TRefCountingNotNullPointer<_Ty> not_null_from_nullable(const TRefCountingPointer<_Ty>& src);
 	template<typename _Ty> TRefCountingNotNullConstPointer<_Ty> not_null_from_nullable(const TRefCountingConstPointer<_Ty>& src);
 
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+	/* With MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER defined, CRefCounter is not polymorphic. The reference count is
+	stored (without a vptr) immediately in front of the target object, and the final release invokes the target object's
+	destructor directly (through the refcounting pointer's target object pointer). In exchange, conversion to a refcounting
+	pointer of a base class type is only supported if the base class has a virtual destructor. */
+	class CRefCounter {
+	private:
+		int m_counter;
+		bool m_is_pooled = false;
+
+	public:
+		CRefCounter() : m_counter(1) {}
+		void increment() { m_counter++; }
+		void decrement() { assert(0 <= m_counter); m_counter--; }
+		int use_count() const { return m_counter; }
+		bool is_pooled() const { return m_is_pooled; }
+
+	protected:
+		void set_is_pooled() { m_is_pooled = true; }
+	};
+
+	template<class Y>
+	class TRefWithTargetObj : public CRefCounter {
+	public:
+		Y m_object;
+
+		template<class ... Args>
+		TRefWithTargetObj(Args && ...args) : m_object(std::forward<Args>(args)...) {}
+	};
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 	class CRefCounter {
 	private:
 		int m_counter;
@@ -124,6 +181,66 @@ namespace mse {
 		}
 	};
 
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+
+	/* TPooledRefWithTargetObj<> is a version of TRefWithTargetObj<> whose memory is drawn from a (thread_local) pool
+	specific to its type rather than directly from the heap. Because CRefCounter has a virtual destructor, deleting it
+	through a CRefCounter pointer will invoke the appropriate (class-specific) deallocation function. (With
+	MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER defined, CRefCounter has no virtual destructor, so instead the object is
+	flagged as pooled and the final release returns its memory to the pool directly.) */
+	template<class Y>
+	class TPooledRefWithTargetObj : public TRefWithTargetObj<Y> {
+	public:
+		template<class ... Args>
+		TPooledRefWithTargetObj(Args && ...args) : TRefWithTargetObj<Y>(std::forward<Args>(args)...) {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			(*this).set_is_pooled();
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+		}
+
+		static void* operator new(size_t size) {
+			assert(sizeof(TPooledRefWithTargetObj) == size);
+			return mse::us::impl::tlSlabPool_ref<TPooledRefWithTargetObj>().allocate();
+		}
+		static void operator delete(void* ptr) {
+			mse::us::impl::CSlabPoolState::deallocate(ptr);
+		}
+	};
+
+	namespace us {
+		namespace impl {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			/* Destroys the target object (through a pointer of static type X) and deallocates the reference counter. */
+			template<class X>
+			void refcounting_destroy(CRefCounter* ref_with_target_obj_ptr, X* target_obj_ptr) {
+				typedef typename std::remove_const<X>::type _TX;
+				const bool is_pooled = ref_with_target_obj_ptr->is_pooled();
+				const_cast<_TX*>(target_obj_ptr)->~_TX();
+				if (is_pooled) {
+					mse::us::impl::CSlabPoolState::deallocate(ref_with_target_obj_ptr);
+				}
+				else {
+					::operator delete(static_cast<void *>(ref_with_target_obj_ptr));
+				}
+			}
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			/* Destroys the target object and deallocates the reference counter. */
+			template<class X>
+			void refcounting_destroy(CRefCounter* ref_with_target_obj_ptr) {
+				delete ref_with_target_obj_ptr;
+			}
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+
+			/* Indicates whether a refcounting pointer targeting a Y can be converted to one targeting an X. */
+			template<class X, class Y>
+			struct is_refcounting_target_convertible : std::integral_constant<bool, std::is_base_of<X, Y>::value
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+				&& (std::is_same<X, Y>::value || std::has_virtual_destructor<X>::value)
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			> {};
+		}
+	}
+
 	/* Some code originally came from this stackoverflow post:
 	http://stackoverflow.com/questions/6593770/creating-a-non-thread-safe-shared-ptr */
 
@@ -141,25 +258,28 @@ namespace mse {
 			//release();
 			/* Doing it this way instead of just calling release() protects against potential reentrant destructor
 			calls caused by a misbehaving (user-defined) destructor of the target object. */
-			auto_release keep(m_ref_with_target_obj_ptr);
+			auto_release keep(*this);
 			m_ref_with_target_obj_ptr = nullptr;
 
 			/* This is just a no-op function that will cause a compile error when X is not an eligible type. */
 			valid_if_X_is_not_an_xscope_type();
 		}
 		TRefCountingPointer(const TRefCountingPointer& r) {
-			acquire(r.m_ref_with_target_obj_ptr);
+			acquire(r);
 		}
 		TRefCountingPointer(TRefCountingPointer&& r) {
 			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			m_target_obj_ptr = r.m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			r.m_ref_with_target_obj_ptr = nullptr;
 		}
 		operator bool() const { return nullptr != get(); }
 		void clear() { (*this) = TRefCountingPointer<X>(nullptr); }
 		TRefCountingPointer& operator=(const TRefCountingPointer& r) {
 			if (this != &r) {
-				auto_release keep(m_ref_with_target_obj_ptr);
-				acquire(r.m_ref_with_target_obj_ptr);
+				auto_release keep(*this);
+				acquire(r);
 			}
 			return *this;
 		}
@@ -180,15 +300,15 @@ namespace mse {
 		signature, the templated one must come first. This is a limitation of the current implementation of Visual C++."
 		*/
 		template <class Y> friend class TRefCountingPointer;
-		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		template <class Y, class = typename std::enable_if<us::impl::is_refcounting_target_convertible<X, Y>::value, void>::type>
 		TRefCountingPointer(const TRefCountingPointer<Y>& r) {
-			acquire(r.m_ref_with_target_obj_ptr);
+			acquire(r);
 		}
-		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		template <class Y, class = typename std::enable_if<us::impl::is_refcounting_target_convertible<X, Y>::value, void>::type>
 		TRefCountingPointer& operator=(const TRefCountingPointer<Y>& r) {
 			if (this != &r) {
-				auto_release keep(m_ref_with_target_obj_ptr);
-				acquire(r.m_ref_with_target_obj_ptr);
+				auto_release keep(*this);
+				acquire(r);
 			}
 			return *this;
 		}
@@ -205,12 +325,12 @@ namespace mse {
 
 		X& operator*() const {
 			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TRefCountingPointer")); }
-			X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+			X* x_ptr = unchecked_get();
 			return (*x_ptr);
 		}
 		X* operator->() const {
 			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TRefCountingPointer")); }
-			X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+			X* x_ptr = unchecked_get();
 			return x_ptr;
 		}
 		bool unique() const {
@@ -223,6 +343,12 @@ namespace mse {
 			TRefCountingPointer retval(new_ptr);
 			return retval;
 		}
+		template <class... Args>
+		static TRefCountingPointer make_pooled(Args&&... args) {
+			auto new_ptr = new TPooledRefWithTargetObj<X>(std::forward<Args>(args)...);
+			TRefCountingPointer retval(new_ptr);
+			return retval;
+		}
 
 	protected:
 		X* get() const {
@@ -230,7 +356,7 @@ namespace mse {
 				return nullptr;
 			}
 			else {
-				X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+				X* x_ptr = unchecked_get();
 				return x_ptr;
 			}
 		}
@@ -238,37 +364,54 @@ namespace mse {
 	private:
 		explicit TRefCountingPointer(TRefWithTargetObj<X>* p/* = nullptr*/) {
 			m_ref_with_target_obj_ptr = p;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			m_target_obj_ptr = std::addressof(p->m_object);
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 		}
 
-		void acquire(CRefCounter* c) {
-			m_ref_with_target_obj_ptr = c;
-			if (c) { c->increment(); }
-		}
-
-		void release() {
-			dorelease(m_ref_with_target_obj_ptr);
+		template<class TRefCountingPointerType>
+		void acquire(const TRefCountingPointerType& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			/* The (implicit) conversion applies any derived-to-base pointer adjustment. */
+			m_target_obj_ptr = r.m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->increment(); }
 		}
 
 		struct auto_release {
-			auto_release(CRefCounter* c) : m_ref_with_target_obj_ptr(c) {}
-			~auto_release() { dorelease(m_ref_with_target_obj_ptr); }
-			CRefCounter* m_ref_with_target_obj_ptr;
-		};
-
-		void static dorelease(CRefCounter* ref_with_target_obj_ptr) {
-			// decrement the count, delete if it is nullptr
-			if (ref_with_target_obj_ptr) {
-				if (1 == ref_with_target_obj_ptr->use_count()) {
-					delete ref_with_target_obj_ptr;
-				}
-				else {
-					ref_with_target_obj_ptr->decrement();
+			auto_release(const TRefCountingPointer& ptr) : m_ref_with_target_obj_ptr(ptr.m_ref_with_target_obj_ptr)
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+				, m_target_obj_ptr(ptr.m_target_obj_ptr)
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			{}
+			~auto_release() {
+				// decrement the count, delete if it is nullptr
+				if (m_ref_with_target_obj_ptr) {
+					if (1 == m_ref_with_target_obj_ptr->use_count()) {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+						us::impl::refcounting_destroy<X>(m_ref_with_target_obj_ptr, m_target_obj_ptr);
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+						us::impl::refcounting_destroy<X>(m_ref_with_target_obj_ptr);
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+					}
+					else {
+						m_ref_with_target_obj_ptr->decrement();
+					}
 				}
 			}
-		}
+			CRefCounter* m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			X* m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+		};
 
 		X* unchecked_get() const {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			X* x_ptr = m_target_obj_ptr;
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			return x_ptr;
 		}
 
@@ -282,6 +425,11 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		CRefCounter* m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+		/* The (possibly base class adjusted) address of the target object. The inline reference counter doesn't know the
+		target object's type, so the address can't be obtained from it. */
+		X* m_target_obj_ptr = nullptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 
 		friend class TRefCountingNotNullPointer<X>;
 		friend class TRefCountingConstPointer<X>;
@@ -315,6 +463,12 @@ namespace mse {
 			TRefCountingNotNullPointer retval(new_ptr);
 			return retval;
 		}
+		template <class... Args>
+		static TRefCountingNotNullPointer make_pooled(Args&&... args) {
+			auto new_ptr = new TPooledRefWithTargetObj<_Ty>(std::forward<Args>(args)...);
+			TRefCountingNotNullPointer retval(new_ptr);
+			return retval;
+		}
 
 	private:
 		explicit TRefCountingNotNullPointer(TRefWithTargetObj<_Ty>* p/* = nullptr*/) : TRefCountingPointer<_Ty>(p) {}
@@ -372,6 +526,14 @@ namespace mse {
 		return TRefCountingPointer<X>::make(std::forward<Args>(args)...);
 	}
 
+	/* make_refcounting_pooled<>() is like make_refcounting<>() except that the memory for the object (and its reference
+	count) is drawn from a thread_local pool specific to the object's type. Deallocated memory is retained by the pool for
+	reuse. */
+	template <class X, class... Args>
+	TRefCountingNotNullPointer<X> make_refcounting_pooled(Args&&... args) {
+		return TRefCountingNotNullPointer<X>::make_pooled(std::forward<Args>(args)...);
+	}
+
 
 	template <class X>
 	class TRefCountingConstPointer : public mse::us::impl::RefCStrongPointerTagBase {
@@ -382,32 +544,38 @@ namespace mse {
 			//release();
 			/* Doing it this way instead of just calling release() protects against potential reentrant destructor
 			calls caused by a misbehaving (user-defined) destructor of the target object. */
-			auto_release keep(m_ref_with_target_obj_ptr);
+			auto_release keep(*this);
 			m_ref_with_target_obj_ptr = nullptr;
 
 			/* This is just a no-op function that will cause a compile error when X is not an eligible type. */
 			valid_if_X_is_not_an_xscope_type();
 		}
 		TRefCountingConstPointer(const TRefCountingConstPointer& r) {
-			acquire(r.m_ref_with_target_obj_ptr);
+			acquire(r);
 		}
 		TRefCountingConstPointer(const TRefCountingPointer<X>& r) {
-			acquire(r.m_ref_with_target_obj_ptr);
+			acquire(r);
 		}
 		TRefCountingConstPointer(TRefCountingConstPointer&& r) {
 			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			m_target_obj_ptr = r.m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			r.m_ref_with_target_obj_ptr = nullptr;
 		}
 		TRefCountingConstPointer(TRefCountingPointer<X>&& r) {
 			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			m_target_obj_ptr = r.m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			r.m_ref_with_target_obj_ptr = nullptr;
 		}
 		operator bool() const { return nullptr != get(); }
 		void clear() { (*this) = TRefCountingConstPointer<X>(nullptr); }
 		TRefCountingConstPointer& operator=(const TRefCountingConstPointer& r) {
 			if (this != &r) {
-				auto_release keep(m_ref_with_target_obj_ptr);
-				acquire(r.m_ref_with_target_obj_ptr);
+				auto_release keep(*this);
+				acquire(r);
 			}
 			return *this;
 		}
@@ -428,15 +596,15 @@ namespace mse {
 		signature, the templated one must come first. This is a limitation of the current implementation of Visual C++."
 		*/
 		template <class Y> friend class TRefCountingConstPointer;
-		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		template <class Y, class = typename std::enable_if<us::impl::is_refcounting_target_convertible<X, Y>::value, void>::type>
 		TRefCountingConstPointer(const TRefCountingConstPointer<Y>& r) {
-			acquire(r.m_ref_with_target_obj_ptr);
+			acquire(r);
 		}
-		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		template <class Y, class = typename std::enable_if<us::impl::is_refcounting_target_convertible<X, Y>::value, void>::type>
 		TRefCountingConstPointer& operator=(const TRefCountingConstPointer<Y>& r) {
 			if (this != &r) {
-				auto_release keep(m_ref_with_target_obj_ptr);
-				acquire(r.m_ref_with_target_obj_ptr);
+				auto_release keep(*this);
+				acquire(r);
 			}
 			return *this;
 		}
@@ -453,12 +621,12 @@ namespace mse {
 
 		const X& operator*() const {
 			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TRefCountingConstPointer")); }
-			X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+			const X* x_ptr = unchecked_get();
 			return (*x_ptr);
 		}
 		const X* operator->() const {
 			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TRefCountingConstPointer")); }
-			X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+			const X* x_ptr = unchecked_get();
 			return x_ptr;
 		}
 		bool unique() const {
@@ -471,7 +639,7 @@ namespace mse {
 				return nullptr;
 			}
 			else {
-				X* x_ptr = static_cast<X*>(m_ref_with_target_obj_ptr->target_obj_address());
+				const X* x_ptr = unchecked_get();
 				return x_ptr;
 			}
 		}
@@ -479,38 +647,54 @@ namespace mse {
 	private:
 		explicit TRefCountingConstPointer(TRefWithTargetObj<X>* p/* = nullptr*/) {
 			m_ref_with_target_obj_ptr = p;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			m_target_obj_ptr = std::addressof(p->m_object);
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 		}
 
-		void acquire(CRefCounter* c) {
-			m_ref_with_target_obj_ptr = c;
-			if (c) { c->increment(); }
-		}
-
-		void release() {
-			dorelease(m_ref_with_target_obj_ptr);
+		template<class TRefCountingPointerType>
+		void acquire(const TRefCountingPointerType& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			/* The (implicit) conversion applies any derived-to-base pointer adjustment. */
+			m_target_obj_ptr = r.m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->increment(); }
 		}
 
 		struct auto_release {
-			auto_release(CRefCounter* c) : m_ref_with_target_obj_ptr(c) {}
-			~auto_release() { dorelease(m_ref_with_target_obj_ptr); }
-			CRefCounter* m_ref_with_target_obj_ptr;
-		};
-
-		void static dorelease(CRefCounter* ref_with_target_obj_ptr) {
-			// decrement the count, delete if it is nullptr
-			if (ref_with_target_obj_ptr) {
-				if (1 == ref_with_target_obj_ptr->use_count()) {
-					delete ref_with_target_obj_ptr;
+			auto_release(const TRefCountingConstPointer& ptr) : m_ref_with_target_obj_ptr(ptr.m_ref_with_target_obj_ptr)
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+				, m_target_obj_ptr(ptr.m_target_obj_ptr)
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			{}
+			~auto_release() {
+				// decrement the count, delete if it is nullptr
+				if (m_ref_with_target_obj_ptr) {
+					if (1 == m_ref_with_target_obj_ptr->use_count()) {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+						us::impl::refcounting_destroy<X>(m_ref_with_target_obj_ptr, m_target_obj_ptr);
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+						us::impl::refcounting_destroy<X>(m_ref_with_target_obj_ptr);
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+					}
+					else {
+						m_ref_with_target_obj_ptr->decrement();
+					}
 				}
-				else {
-					ref_with_target_obj_ptr->decrement();
-				}
-				ref_with_target_obj_ptr = nullptr;
 			}
-		}
+			CRefCounter* m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			X* m_target_obj_ptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+		};
 
 		const X* unchecked_get() const {
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+			const X* x_ptr = m_target_obj_ptr;
+#else // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			const X* x_ptr = static_cast<const X*>(m_ref_with_target_obj_ptr->target_obj_address());
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 			return x_ptr;
 		}
 
@@ -524,6 +708,11 @@ namespace mse {
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 
 		CRefCounter* m_ref_with_target_obj_ptr;
+#ifdef MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
+		/* The (possibly base class adjusted) address of the target object. The inline reference counter doesn't know the
+		target object's type, so the address can't be obtained from it. */
+		X* m_target_obj_ptr = nullptr;
+#endif // MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER
 
 		friend class TRefCountingNotNullConstPointer<X>;
 	};
@@ -594,6 +783,697 @@ namespace mse {
 
 		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
 	};
+
+
+	/* TAtomicRefCountingPointer<> is a version of TRefCountingPointer<> whose reference count is thread safe. It uses
+	"biased" reference counting: the reference count is split into a part that is only ever modified by the thread that
+	created the target object (the "owner" thread), which it modifies without using atomic operations, and a part that
+	is modified (atomically) by all other threads. So a thread that only copies pointers to objects it created itself
+	doesn't incur the cost of atomic operations. */
+	namespace us {
+		namespace impl {
+			class CBiasedRefCounter;
+
+			/* Each thread that creates atomic refcounting pointer targets has an associated CBRCOwnerState. Targets whose
+			(non-owner thread) reference count goes negative are queued here for the owner thread to merge the two parts
+			of their reference count. The queue is an intrusive (lock-free) list threaded through the queued targets, so
+			queueing never allocates (or throws). A queued target isn't released until the owner thread next creates or
+			releases an atomic refcounting pointer target, or calls mse::process_pending_atomic_refcounting_releases(), or
+			exits. So a queued target (whose count may have dropped to zero) can outlive its last pointer for as long as its
+			owner thread is otherwise occupied. */
+			class CBRCOwnerState {
+			public:
+				void add_ref() { m_refcount.fetch_add(1, std::memory_order_relaxed); }
+				void release_ref() {
+					if (1 == m_refcount.fetch_sub(1, std::memory_order_acq_rel)) {
+						delete this;
+					}
+				}
+				/* Called from the owner thread. */
+				void process_pending() {
+					if (nullptr != m_pending_head.load(std::memory_order_relaxed)) {
+						process_pending_slow();
+					}
+				}
+				/* Called from non-owner threads. */
+				inline void enqueue(CBiasedRefCounter* ref_ptr);
+				/* Called from the owner thread when it exits. */
+				inline void set_owner_exited();
+
+			private:
+				inline void process_pending_slow();
+				static inline void merge_and_release_list(CBiasedRefCounter* ref_ptr);
+				/* A (non-dereferenceable) value for m_pending_head that indicates that the owner thread has exited and will no
+				longer process the queue. */
+				static CBiasedRefCounter* closed_queue_marker() {
+					static char s_marker_byte = 0;
+					return reinterpret_cast<CBiasedRefCounter*>(&s_marker_byte);
+				}
+
+				std::atomic<int> m_refcount{ 1 };
+				std::atomic<CBiasedRefCounter*> m_pending_head{ nullptr };
+			};
+
+			inline CBRCOwnerState*& tl_brc_owner_state_ptr_ref() {
+				thread_local CBRCOwnerState* tl_owner_state_ptr = nullptr;
+				return tl_owner_state_ptr;
+			}
+			inline bool& tl_brc_owner_exited_ref() {
+				thread_local bool tl_owner_exited = false;
+				return tl_owner_exited;
+			}
+
+			class CBRCOwnerStateHolder {
+			public:
+				CBRCOwnerStateHolder() : m_owner_state_ptr(new CBRCOwnerState) {
+					tl_brc_owner_state_ptr_ref() = m_owner_state_ptr;
+				}
+				~CBRCOwnerStateHolder() {
+					/* Any reference count operations this thread does from here on will be treated as those of a non-owner
+					thread. */
+					tl_brc_owner_state_ptr_ref() = nullptr;
+					tl_brc_owner_exited_ref() = true;
+					m_owner_state_ptr->set_owner_exited();
+					m_owner_state_ptr->release_ref();
+				}
+
+			private:
+				CBRCOwnerState* m_owner_state_ptr = nullptr;
+			};
+
+			/* Returns the owner state of the current thread, creating it if necessary. Returns nullptr if the thread is
+			exiting. */
+			inline CBRCOwnerState* brc_current_owner_state() {
+				auto owner_state_ptr = tl_brc_owner_state_ptr_ref();
+				if (!owner_state_ptr) {
+					if (tl_brc_owner_exited_ref()) {
+						return nullptr;
+					}
+					thread_local CBRCOwnerStateHolder tl_owner_state_holder;
+					owner_state_ptr = tl_brc_owner_state_ptr_ref();
+				}
+				return owner_state_ptr;
+			}
+
+			class CBiasedRefCounter {
+			public:
+				CBiasedRefCounter() : m_owner_state_ptr(brc_current_owner_state()) {
+					if (m_owner_state_ptr) {
+						m_owner_state_ptr->add_ref();
+						m_owner_state_ptr->process_pending();
+					}
+					else {
+						/* No owner thread, so all reference count operations will be atomic. */
+						m_biased_count = 0;
+						m_owner_merged = true;
+						m_shared_count_and_flags.store(sc_count_unit | sc_merged_flag, std::memory_order_relaxed);
+					}
+				}
+				virtual ~CBiasedRefCounter() {
+					if (m_owner_state_ptr) {
+						m_owner_state_ptr->release_ref();
+					}
+				}
+
+				void increment() {
+					if (is_owner_thread() && (!m_owner_merged)) {
+						m_biased_count += 1;
+					}
+					else {
+						m_shared_count_and_flags.fetch_add(sc_count_unit, std::memory_order_relaxed);
+					}
+				}
+				/* Decrements the reference count, and deletes the object if the count drops to zero. */
+				void release() {
+					if (is_owner_thread() && (!m_owner_merged)) {
+						m_biased_count -= 1;
+						if (0 == m_biased_count) {
+							owner_release_last_biased_ref();
+						}
+					}
+					else {
+						shared_release();
+					}
+				}
+				/* The returned value is only reliable when there are no concurrent reference count operations. */
+				long long use_count() const {
+					auto value = m_shared_count_and_flags.load(std::memory_order_acquire);
+					long long retval = (value - (value & sc_flags_mask)) / sc_count_unit;
+					if (is_owner_thread() && (!m_owner_merged)) {
+						retval += m_biased_count;
+					}
+					return retval;
+				}
+
+			private:
+				void owner_release_last_biased_ref() {
+					auto owner_state_ptr = m_owner_state_ptr;
+					auto new_value = merge_biased_count();
+					if (is_zero_count_and_not_queued(new_value)) {
+						delete this;
+					}
+					owner_state_ptr->process_pending();
+				}
+				void shared_release() {
+					if (sc_merged_flag & m_shared_count_and_flags.load(std::memory_order_relaxed)) {
+						/* Once merged, the object cannot become unmerged. */
+						auto new_value = m_shared_count_and_flags.fetch_sub(sc_count_unit, std::memory_order_acq_rel) - sc_count_unit;
+						if (is_zero_count_and_not_queued(new_value)) {
+							delete this;
+						}
+						return;
+					}
+					/* If the shared part of the (unmerged) count goes negative, the owner thread must be notified so that it
+					can merge the two parts of the count. The "queued" flag is set in the same atomic operation as the
+					decrement so that the owner cannot delete the object (upon merging) while it's queued. */
+					auto value = m_shared_count_and_flags.load(std::memory_order_relaxed);
+					auto new_value = value;
+					do {
+						new_value = value - sc_count_unit;
+						if ((!(sc_merged_flag & new_value)) && (0 > new_value)) {
+							new_value |= sc_queued_flag;
+						}
+					} while (!m_shared_count_and_flags.compare_exchange_weak(value, new_value, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+					if ((sc_queued_flag & new_value) && (!(sc_queued_flag & value))) {
+						m_owner_state_ptr->enqueue(this);
+					}
+					else if (is_zero_count_and_not_queued(new_value)) {
+						delete this;
+					}
+				}
+				bool is_owner_thread() const {
+					auto owner_state_ptr = tl_brc_owner_state_ptr_ref();
+					return ((m_owner_state_ptr == owner_state_ptr) && (nullptr != owner_state_ptr));
+				}
+				/* Note that the count can only reach zero once the biased count has been merged. */
+				static bool is_zero_count_and_not_queued(long long value) {
+					return (sc_merged_flag == value);
+				}
+				/* Only called by the owner thread (or after the owner thread has exited). */
+				long long merge_biased_count() {
+					assert(!m_owner_merged);
+					const long long addend = m_biased_count * sc_count_unit + sc_merged_flag;
+					m_biased_count = 0;
+					m_owner_merged = true;
+					return m_shared_count_and_flags.fetch_add(addend, std::memory_order_acq_rel) + addend;
+				}
+				/* Only called by the owner thread (or after the owner thread has exited). */
+				void merge_and_release_queued() {
+					if (!m_owner_merged) {
+						merge_biased_count();
+					}
+					auto new_value = m_shared_count_and_flags.fetch_and(~sc_queued_flag, std::memory_order_acq_rel) & (~sc_queued_flag);
+					if (is_zero_count_and_not_queued(new_value)) {
+						delete this;
+					}
+				}
+
+				static const long long sc_merged_flag = 1;
+				static const long long sc_queued_flag = 2;
+				static const long long sc_flags_mask = 3;
+				static const long long sc_count_unit = 4;
+
+				CBRCOwnerState* const m_owner_state_ptr = nullptr;
+				/* Accessed only by the owner thread. */
+				long long m_biased_count = 1;
+				bool m_owner_merged = false;
+				/* The (non-owner) count (which may be negative) in units of sc_count_unit, plus flags. */
+				std::atomic<long long> m_shared_count_and_flags{ 0 };
+				/* The next target in the owner's queue (while this one is queued). */
+				CBiasedRefCounter* m_next_queued_ptr = nullptr;
+
+				friend class CBRCOwnerState;
+			};
+
+			inline void CBRCOwnerState::enqueue(CBiasedRefCounter* ref_ptr) {
+				/* Acquire ordering so that, if the queue has been closed, the owner thread's (last) modifications of the biased
+				count are visible here. */
+				auto head_ptr = m_pending_head.load(std::memory_order_acquire);
+				do {
+					if (closed_queue_marker() == head_ptr) {
+						/* The owner thread won't be touching the biased count anymore, so we can merge it here. */
+						ref_ptr->merge_and_release_queued();
+						return;
+					}
+					ref_ptr->m_next_queued_ptr = head_ptr;
+				} while (!m_pending_head.compare_exchange_weak(head_ptr, ref_ptr, std::memory_order_release, std::memory_order_acquire));
+			}
+			inline void CBRCOwnerState::merge_and_release_list(CBiasedRefCounter* ref_ptr) {
+				while (ref_ptr) {
+					/* merge_and_release_queued() may delete the target, so we need to obtain the next one first. */
+					auto next_ptr = ref_ptr->m_next_queued_ptr;
+					ref_ptr->merge_and_release_queued();
+					ref_ptr = next_ptr;
+				}
+			}
+			inline void CBRCOwnerState::process_pending_slow() {
+				merge_and_release_list(m_pending_head.exchange(nullptr, std::memory_order_acquire));
+			}
+			inline void CBRCOwnerState::set_owner_exited() {
+				merge_and_release_list(m_pending_head.exchange(closed_queue_marker(), std::memory_order_acq_rel));
+			}
+
+			template<class Y>
+			class TAtomicRefWithTargetObj : public CBiasedRefCounter {
+			public:
+				Y m_object;
+
+				template<class ... Args>
+				TAtomicRefWithTargetObj(Args && ...args) : m_object(std::forward<Args>(args)...) {}
+			};
+		}
+	}
+
+	template <class X> class TAtomicRefCountingPointer;
+	template <class X> class TAtomicRefCountingNotNullPointer;
+	template <class X> class TAtomicRefCountingFixedPointer;
+	template <class X> class TAtomicRefCountingConstPointer;
+	template <class X> class TAtomicRefCountingNotNullConstPointer;
+	template <class X> class TAtomicRefCountingFixedConstPointer;
+
+	template<typename _Ty> TAtomicRefCountingNotNullPointer<_Ty> not_null_from_nullable(const TAtomicRefCountingPointer<_Ty>& src);
+	template<typename _Ty> TAtomicRefCountingNotNullConstPointer<_Ty> not_null_from_nullable(const TAtomicRefCountingConstPointer<_Ty>& src);
+
+	template <class X>
+	class TAtomicRefCountingPointer : public mse::us::impl::StrongPointerTagBase {
+	public:
+		TAtomicRefCountingPointer() : m_ref_with_target_obj_ptr(nullptr) {}
+		TAtomicRefCountingPointer(std::nullptr_t) : m_ref_with_target_obj_ptr(nullptr) {}
+		~TAtomicRefCountingPointer() {
+			auto_release keep(m_ref_with_target_obj_ptr);
+			m_ref_with_target_obj_ptr = nullptr;
+
+			/* This is just a no-op function that will cause a compile error when X is not an eligible type. */
+			valid_if_X_is_not_an_xscope_type();
+		}
+		TAtomicRefCountingPointer(const TAtomicRefCountingPointer& r) {
+			acquire(r);
+		}
+		TAtomicRefCountingPointer(TAtomicRefCountingPointer&& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+			m_target_obj_ptr = r.m_target_obj_ptr;
+			r.m_ref_with_target_obj_ptr = nullptr;
+		}
+		operator bool() const { return nullptr != get(); }
+		void clear() { (*this) = TAtomicRefCountingPointer<X>(nullptr); }
+		TAtomicRefCountingPointer& operator=(const TAtomicRefCountingPointer& r) {
+			if (this != &r) {
+				auto_release keep(m_ref_with_target_obj_ptr);
+				acquire(r);
+			}
+			return *this;
+		}
+		bool operator<(const TAtomicRefCountingPointer& r) const {
+			return get() < r.get();
+		}
+		bool operator==(const TAtomicRefCountingPointer& r) const {
+			return get() == r.get();
+		}
+		bool operator!=(const TAtomicRefCountingPointer& r) const {
+			return get() != r.get();
+		}
+
+#ifndef MSE_REFCOUNTINGPOINTER_DISABLE_MEMBER_TEMPLATES
+		template <class Y> friend class TAtomicRefCountingPointer;
+		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		TAtomicRefCountingPointer(const TAtomicRefCountingPointer<Y>& r) {
+			acquire(r);
+		}
+		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		TAtomicRefCountingPointer& operator=(const TAtomicRefCountingPointer<Y>& r) {
+			auto_release keep(m_ref_with_target_obj_ptr);
+			acquire(r);
+			return *this;
+		}
+		template <class Y> bool operator<(const TAtomicRefCountingPointer<Y>& r) const {
+			return get() < r.get();
+		}
+		template <class Y> bool operator==(const TAtomicRefCountingPointer<Y>& r) const {
+			return get() == r.get();
+		}
+		template <class Y> bool operator!=(const TAtomicRefCountingPointer<Y>& r) const {
+			return get() != r.get();
+		}
+#endif // !MSE_REFCOUNTINGPOINTER_DISABLE_MEMBER_TEMPLATES
+
+		X& operator*() const {
+			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TAtomicRefCountingPointer")); }
+			return *unchecked_get();
+		}
+		X* operator->() const {
+			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TAtomicRefCountingPointer")); }
+			return unchecked_get();
+		}
+
+		template <class... Args>
+		static TAtomicRefCountingPointer make(Args&&... args) {
+			auto new_ptr = new us::impl::TAtomicRefWithTargetObj<X>(std::forward<Args>(args)...);
+			TAtomicRefCountingPointer retval(new_ptr);
+			return retval;
+		}
+
+		/* The pointer is safe to pass to (and share with) other threads if the target type is "marked" as safe to
+		share among threads. */
+		template<class X2 = X, class = typename std::enable_if<(std::is_same<X2, X>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<X2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	protected:
+		X* get() const {
+			if (!m_ref_with_target_obj_ptr) {
+				return nullptr;
+			}
+			else {
+				return unchecked_get();
+			}
+		}
+
+	private:
+		explicit TAtomicRefCountingPointer(us::impl::TAtomicRefWithTargetObj<X>* p/* = nullptr*/) {
+			m_ref_with_target_obj_ptr = p;
+			m_target_obj_ptr = std::addressof(p->m_object);
+		}
+
+		template<class TAtomicRefCountingPointerType>
+		void acquire(const TAtomicRefCountingPointerType& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+			/* The (implicit) conversion applies any derived-to-base pointer adjustment. */
+			m_target_obj_ptr = r.m_target_obj_ptr;
+			if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->increment(); }
+		}
+
+		struct auto_release {
+			auto_release(us::impl::CBiasedRefCounter* c) : m_ref_with_target_obj_ptr(c) {}
+			~auto_release() { if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->release(); } }
+			us::impl::CBiasedRefCounter* m_ref_with_target_obj_ptr;
+		};
+
+		X* unchecked_get() const {
+			return m_target_obj_ptr;
+		}
+
+#ifndef MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class X2 = X, class = typename std::enable_if<(std::is_same<X2, X>::value) && (mse::impl::is_potentially_not_xscope<X2>::value), void>::type>
+#endif // !MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
+		void valid_if_X_is_not_an_xscope_type() const {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		us::impl::CBiasedRefCounter* m_ref_with_target_obj_ptr;
+		/* The (possibly base class adjusted) address of the target object. */
+		X* m_target_obj_ptr = nullptr;
+
+		friend class TAtomicRefCountingNotNullPointer<X>;
+		friend class TAtomicRefCountingConstPointer<X>;
+	};
+
+	template<typename _Ty>
+	class TAtomicRefCountingNotNullPointer : public TAtomicRefCountingPointer<_Ty>, public mse::us::impl::NeverNullTagBase {
+	public:
+		TAtomicRefCountingNotNullPointer(const TAtomicRefCountingNotNullPointer& src_cref) : TAtomicRefCountingPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingNotNullPointer(TAtomicRefCountingNotNullPointer&& src_ref) : TAtomicRefCountingPointer<_Ty>(src_ref) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAtomicRefCountingNotNullPointer() {}
+
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+		TAtomicRefCountingNotNullPointer<_Ty>& operator=(const TAtomicRefCountingNotNullPointer<_Ty>& _Right_cref) {
+			TAtomicRefCountingPointer<_Ty>::operator=(_Right_cref);
+			return (*this);
+		}
+
+		_Ty& operator*() const {
+			return *((*this).unchecked_get());
+		}
+		_Ty* operator->() const {
+			return (*this).unchecked_get();
+		}
+
+		template <class... Args>
+		static TAtomicRefCountingNotNullPointer make(Args&&... args) {
+			auto new_ptr = new us::impl::TAtomicRefWithTargetObj<_Ty>(std::forward<Args>(args)...);
+			TAtomicRefCountingNotNullPointer retval(new_ptr);
+			return retval;
+		}
+
+	private:
+		explicit TAtomicRefCountingNotNullPointer(us::impl::TAtomicRefWithTargetObj<_Ty>* p/* = nullptr*/) : TAtomicRefCountingPointer<_Ty>(p) {}
+
+		/* If you want to use this constructor, use not_null_from_nullable() instead. */
+		TAtomicRefCountingNotNullPointer(const TAtomicRefCountingPointer<_Ty>& src_cref) : TAtomicRefCountingPointer<_Ty>(src_cref) {
+			*src_cref; // to ensure that src_cref points to a valid target
+		}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class TAtomicRefCountingFixedPointer<_Ty>;
+		template<typename _Ty2>
+		friend TAtomicRefCountingNotNullPointer<_Ty2> not_null_from_nullable(const TAtomicRefCountingPointer<_Ty2>& src);
+	};
+
+	template<typename _Ty>
+	class TAtomicRefCountingFixedPointer : public TAtomicRefCountingNotNullPointer<_Ty> {
+	public:
+		TAtomicRefCountingFixedPointer(const TAtomicRefCountingFixedPointer& src_cref) : TAtomicRefCountingNotNullPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedPointer(const TAtomicRefCountingNotNullPointer<_Ty>& src_cref) : TAtomicRefCountingNotNullPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedPointer(TAtomicRefCountingFixedPointer<_Ty>&& src_ref) : TAtomicRefCountingNotNullPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		TAtomicRefCountingFixedPointer(TAtomicRefCountingNotNullPointer<_Ty>&& src_ref) : TAtomicRefCountingNotNullPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAtomicRefCountingFixedPointer() {}
+
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		TAtomicRefCountingFixedPointer<_Ty>& operator=(const TAtomicRefCountingFixedPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+
+	template <class X>
+	class TAtomicRefCountingConstPointer : public mse::us::impl::StrongPointerTagBase {
+	public:
+		TAtomicRefCountingConstPointer() : m_ref_with_target_obj_ptr(nullptr) {}
+		TAtomicRefCountingConstPointer(std::nullptr_t) : m_ref_with_target_obj_ptr(nullptr) {}
+		~TAtomicRefCountingConstPointer() {
+			auto_release keep(m_ref_with_target_obj_ptr);
+			m_ref_with_target_obj_ptr = nullptr;
+
+			/* This is just a no-op function that will cause a compile error when X is not an eligible type. */
+			valid_if_X_is_not_an_xscope_type();
+		}
+		TAtomicRefCountingConstPointer(const TAtomicRefCountingConstPointer& r) {
+			acquire(r);
+		}
+		TAtomicRefCountingConstPointer(const TAtomicRefCountingPointer<X>& r) {
+			acquire(r);
+		}
+		TAtomicRefCountingConstPointer(TAtomicRefCountingConstPointer&& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+			m_target_obj_ptr = r.m_target_obj_ptr;
+			r.m_ref_with_target_obj_ptr = nullptr;
+		}
+		TAtomicRefCountingConstPointer(TAtomicRefCountingPointer<X>&& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+			m_target_obj_ptr = r.m_target_obj_ptr;
+			r.m_ref_with_target_obj_ptr = nullptr;
+		}
+		operator bool() const { return nullptr != get(); }
+		void clear() { (*this) = TAtomicRefCountingConstPointer<X>(nullptr); }
+		TAtomicRefCountingConstPointer& operator=(const TAtomicRefCountingConstPointer& r) {
+			if (this != &r) {
+				auto_release keep(m_ref_with_target_obj_ptr);
+				acquire(r);
+			}
+			return *this;
+		}
+		bool operator<(const TAtomicRefCountingConstPointer& r) const {
+			return get() < r.get();
+		}
+		bool operator==(const TAtomicRefCountingConstPointer& r) const {
+			return get() == r.get();
+		}
+		bool operator!=(const TAtomicRefCountingConstPointer& r) const {
+			return get() != r.get();
+		}
+
+#ifndef MSE_REFCOUNTINGPOINTER_DISABLE_MEMBER_TEMPLATES
+		template <class Y> friend class TAtomicRefCountingConstPointer;
+		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		TAtomicRefCountingConstPointer(const TAtomicRefCountingConstPointer<Y>& r) {
+			acquire(r);
+		}
+		template <class Y, class = typename std::enable_if<std::is_base_of<X, Y>::value, void>::type>
+		TAtomicRefCountingConstPointer& operator=(const TAtomicRefCountingConstPointer<Y>& r) {
+			auto_release keep(m_ref_with_target_obj_ptr);
+			acquire(r);
+			return *this;
+		}
+		template <class Y> bool operator<(const TAtomicRefCountingConstPointer<Y>& r) const {
+			return get() < r.get();
+		}
+		template <class Y> bool operator==(const TAtomicRefCountingConstPointer<Y>& r) const {
+			return get() == r.get();
+		}
+		template <class Y> bool operator!=(const TAtomicRefCountingConstPointer<Y>& r) const {
+			return get() != r.get();
+		}
+#endif // !MSE_REFCOUNTINGPOINTER_DISABLE_MEMBER_TEMPLATES
+
+		const X& operator*() const {
+			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TAtomicRefCountingConstPointer")); }
+			return *unchecked_get();
+		}
+		const X* operator->() const {
+			if (!m_ref_with_target_obj_ptr) { MSE_THROW(refcounting_null_dereference_error("attempt to dereference null pointer - mse::TAtomicRefCountingConstPointer")); }
+			return unchecked_get();
+		}
+
+		/* The pointer is safe to pass to (and share with) other threads if the target type is "marked" as safe to
+		share among threads. */
+		template<class X2 = X, class = typename std::enable_if<(std::is_same<X2, X>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<X2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	protected:
+		const X* get() const {
+			if (!m_ref_with_target_obj_ptr) {
+				return nullptr;
+			}
+			else {
+				return unchecked_get();
+			}
+		}
+
+	private:
+		template<class TAtomicRefCountingPointerType>
+		void acquire(const TAtomicRefCountingPointerType& r) {
+			m_ref_with_target_obj_ptr = r.m_ref_with_target_obj_ptr;
+			/* The (implicit) conversion applies any derived-to-base pointer adjustment. */
+			m_target_obj_ptr = r.m_target_obj_ptr;
+			if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->increment(); }
+		}
+
+		struct auto_release {
+			auto_release(us::impl::CBiasedRefCounter* c) : m_ref_with_target_obj_ptr(c) {}
+			~auto_release() { if (m_ref_with_target_obj_ptr) { m_ref_with_target_obj_ptr->release(); } }
+			us::impl::CBiasedRefCounter* m_ref_with_target_obj_ptr;
+		};
+
+		const X* unchecked_get() const {
+			return m_target_obj_ptr;
+		}
+
+#ifndef MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class X2 = X, class = typename std::enable_if<(std::is_same<X2, X>::value) && (mse::impl::is_potentially_not_xscope<X2>::value), void>::type>
+#endif // !MSE_REFCOUNTING_NO_XSCOPE_DEPENDENCE
+		void valid_if_X_is_not_an_xscope_type() const {}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		us::impl::CBiasedRefCounter* m_ref_with_target_obj_ptr;
+		/* The (possibly base class adjusted) address of the target object. */
+		X* m_target_obj_ptr = nullptr;
+
+		friend class TAtomicRefCountingNotNullConstPointer<X>;
+	};
+
+	template<typename _Ty>
+	class TAtomicRefCountingNotNullConstPointer : public TAtomicRefCountingConstPointer<_Ty>, public mse::us::impl::NeverNullTagBase {
+	public:
+		TAtomicRefCountingNotNullConstPointer(const TAtomicRefCountingNotNullConstPointer& src_cref) : TAtomicRefCountingConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingNotNullConstPointer(const TAtomicRefCountingNotNullPointer<_Ty>& src_cref) : TAtomicRefCountingConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingNotNullConstPointer(TAtomicRefCountingNotNullConstPointer&& src_ref) : TAtomicRefCountingConstPointer<_Ty>(src_ref) {}
+		TAtomicRefCountingNotNullConstPointer(TAtomicRefCountingNotNullPointer<_Ty>&& src_ref) : TAtomicRefCountingConstPointer<_Ty>(src_ref) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAtomicRefCountingNotNullConstPointer() {}
+
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+		TAtomicRefCountingNotNullConstPointer<_Ty>& operator=(const TAtomicRefCountingNotNullConstPointer<_Ty>& _Right_cref) {
+			TAtomicRefCountingConstPointer<_Ty>::operator=(_Right_cref);
+			return (*this);
+		}
+
+		const _Ty& operator*() const {
+			return *((*this).unchecked_get());
+		}
+		const _Ty* operator->() const {
+			return (*this).unchecked_get();
+		}
+
+	private:
+		/* If you want to use this constructor, use not_null_from_nullable() instead. */
+		TAtomicRefCountingNotNullConstPointer(const TAtomicRefCountingConstPointer<_Ty>& src_cref) : TAtomicRefCountingConstPointer<_Ty>(src_cref) {
+			*src_cref; // to ensure that src_cref points to a valid target
+		}
+		TAtomicRefCountingNotNullConstPointer(const TAtomicRefCountingPointer<_Ty>& src_cref) : TAtomicRefCountingConstPointer<_Ty>(src_cref) {
+			*src_cref; // to ensure that src_cref points to a valid target
+		}
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+
+		friend class TAtomicRefCountingFixedConstPointer<_Ty>;
+		template<typename _Ty2>
+		friend TAtomicRefCountingNotNullConstPointer<_Ty2> not_null_from_nullable(const TAtomicRefCountingConstPointer<_Ty2>& src);
+	};
+
+	template<typename _Ty>
+	class TAtomicRefCountingFixedConstPointer : public TAtomicRefCountingNotNullConstPointer<_Ty> {
+	public:
+		TAtomicRefCountingFixedConstPointer(const TAtomicRefCountingFixedConstPointer& src_cref) : TAtomicRefCountingNotNullConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedConstPointer(const TAtomicRefCountingFixedPointer<_Ty>& src_cref) : TAtomicRefCountingNotNullConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedConstPointer(const TAtomicRefCountingNotNullConstPointer<_Ty>& src_cref) : TAtomicRefCountingNotNullConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedConstPointer(const TAtomicRefCountingNotNullPointer<_Ty>& src_cref) : TAtomicRefCountingNotNullConstPointer<_Ty>(src_cref) {}
+		TAtomicRefCountingFixedConstPointer(TAtomicRefCountingFixedConstPointer&& src_ref) : TAtomicRefCountingNotNullConstPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		TAtomicRefCountingFixedConstPointer(TAtomicRefCountingFixedPointer<_Ty>&& src_ref) : TAtomicRefCountingNotNullConstPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		TAtomicRefCountingFixedConstPointer(TAtomicRefCountingNotNullConstPointer<_Ty>&& src_ref) : TAtomicRefCountingNotNullConstPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		TAtomicRefCountingFixedConstPointer(TAtomicRefCountingNotNullPointer<_Ty>&& src_ref) : TAtomicRefCountingNotNullConstPointer<_Ty>(std::forward<decltype(src_ref)>(src_ref)) {}
+		MSE_IMPL_DESTRUCTOR_PREFIX1 ~TAtomicRefCountingFixedConstPointer() {}
+
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value)
+			&& (mse::impl::is_marked_as_shareable_msemsearray<_Ty2>::value), void>::type>
+		void async_shareable_and_passable_tag() const {}
+
+	private:
+		TAtomicRefCountingFixedConstPointer<_Ty>& operator=(const TAtomicRefCountingFixedConstPointer<_Ty>& _Right_cref) = delete;
+
+		MSE_DEFAULT_OPERATOR_AMPERSAND_DECLARATION;
+	};
+
+	template<typename _Ty>
+	TAtomicRefCountingNotNullPointer<_Ty> not_null_from_nullable(const TAtomicRefCountingPointer<_Ty>& src) {
+		return src;
+	}
+	template<typename _Ty>
+	TAtomicRefCountingNotNullConstPointer<_Ty> not_null_from_nullable(const TAtomicRefCountingConstPointer<_Ty>& src) {
+		return src;
+	}
+
+	template <class X, class... Args>
+	TAtomicRefCountingNotNullPointer<X> make_atomic_refcounting(Args&&... args) {
+		return TAtomicRefCountingNotNullPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+	template <class X, class... Args>
+	TAtomicRefCountingPointer<X> make_nullable_atomic_refcounting(Args&&... args) {
+		return TAtomicRefCountingPointer<X>::make(std::forward<Args>(args)...);
+	}
+
+	/* Targets whose last reference was released by a thread other than the one that created them may (depending on
+	the order of the releases) not be deallocated until the creating thread next creates an atomic refcounting pointer
+	target, releases its last reference to one, or exits. A thread can call this function to deallocate them without waiting. */
+	inline void process_pending_atomic_refcounting_releases() {
+		auto owner_state_ptr = us::impl::tl_brc_owner_state_ptr_ref();
+		if (owner_state_ptr) {
+			owner_state_ptr->process_pending();
+		}
+	}
 }
 
 namespace std {
@@ -670,6 +1550,31 @@ namespace std {
 			return (hash<const _Ty *>()(ptr1));
 		}
 	};
+
+	template<class _Ty>
+	struct hash<mse::TAtomicRefCountingPointer<_Ty> > {	// hash functor
+		typedef mse::TAtomicRefCountingPointer<_Ty> argument_type;
+		typedef size_t result_type;
+		size_t operator()(const mse::TAtomicRefCountingPointer<_Ty>& _Keyval) const _NOEXCEPT {
+			const _Ty* ptr1 = nullptr;
+			if (_Keyval) {
+				ptr1 = std::addressof(*_Keyval);
+			}
+			return (hash<const _Ty *>()(ptr1));
+		}
+	};
+	template<class _Ty>
+	struct hash<mse::TAtomicRefCountingConstPointer<_Ty> > {	// hash functor
+		typedef mse::TAtomicRefCountingConstPointer<_Ty> argument_type;
+		typedef size_t result_type;
+		size_t operator()(const mse::TAtomicRefCountingConstPointer<_Ty>& _Keyval) const _NOEXCEPT {
+			const _Ty* ptr1 = nullptr;
+			if (_Keyval) {
+				ptr1 = std::addressof(*_Keyval);
+			}
+			return (hash<const _Ty *>()(ptr1));
+		}
+	};
 }
 
 namespace mse {
@@ -1091,6 +1996,46 @@ namespace mse {
 				int k = D_refcountingfixed_ptr1->b;
 			}
 
+#if defined(MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER) || defined(MSE_REFCOUNTINGPOINTER_DISABLED)
+			{
+				/* Conversion to a refcounting pointer of a (non-primary) base class type. (Not supported with the default
+				reference counter.) */
+				class E {
+				public:
+					virtual ~E() {}
+					int e = 1;
+				};
+				class F {
+				public:
+					F(int* destruction_count_ptr) : m_destruction_count_ptr(destruction_count_ptr) {}
+					virtual ~F() { (*m_destruction_count_ptr) += 1; }
+					int f = 2;
+					int* m_destruction_count_ptr;
+				};
+				class EF : public E, public F {
+				public:
+					EF(int* destruction_count_ptr) : F(destruction_count_ptr) {}
+				};
+				int destruction_count = 0;
+				{
+					auto EF_refcountingfixed_ptr1 = mse::make_refcounting<EF>(&destruction_count);
+					mse::TRefCountingPointer<F> F_refcounting_ptr1 = EF_refcountingfixed_ptr1;
+					assert(2 == F_refcounting_ptr1->f);
+					assert(static_cast<F*>(std::addressof(*EF_refcountingfixed_ptr1)) == std::addressof(*F_refcounting_ptr1));
+					mse::TRefCountingConstPointer<EF> EF_refcounting_cptr1 = EF_refcountingfixed_ptr1;
+					mse::TRefCountingConstPointer<F> F_refcounting_cptr1 = EF_refcounting_cptr1;
+					assert(2 == F_refcounting_cptr1->f);
+
+					mse::TRefCountingPointer<F> F_refcounting_ptr2 = mse::make_refcounting<EF>(&destruction_count);
+					F_refcounting_ptr2 = F_refcounting_ptr1;
+					assert(1 == destruction_count);
+					assert(2 == F_refcounting_ptr2->f);
+				}
+				/* The last owning pointers were of base class type. */
+				assert(2 == destruction_count);
+			}
+#endif // defined(MSE_REFCOUNTINGPOINTER_USE_INLINE_COUNTER) || defined(MSE_REFCOUNTINGPOINTER_DISABLED)
+
 			{
 				/* You can use the "mse::make_pointer_to_member_v2()" function to obtain a safe pointer to a member of
 				an object owned by a refcounting pointer. */
@@ -1114,6 +2059,85 @@ namespace mse {
 					int q = 7;
 				}
 			}
+#endif // MSE_SELF_TESTS
+		}
+
+		void test2() {
+#ifdef MSE_SELF_TESTS
+			class F {
+			public:
+				F(std::atomic<int>* destruction_count_ptr) : m_destruction_count_ptr(destruction_count_ptr) {}
+				virtual ~F() { (*m_destruction_count_ptr) += 1; }
+				int f = 2;
+				std::atomic<int>* m_destruction_count_ptr;
+			};
+
+			{
+				/* Conversions of atomic refcounting pointers to pointers of (non-primary) base class type, and to const
+				pointers. */
+				class E {
+				public:
+					virtual ~E() {}
+					int e = 1;
+				};
+				class EF : public E, public F {
+				public:
+					EF(std::atomic<int>* destruction_count_ptr) : F(destruction_count_ptr) {}
+				};
+				std::atomic<int> destruction_count{ 0 };
+				{
+					auto EF_atomic_refcountingnn_ptr1 = mse::make_atomic_refcounting<EF>(&destruction_count);
+					mse::TAtomicRefCountingPointer<EF> EF_atomic_refcounting_ptr1 = EF_atomic_refcountingnn_ptr1;
+					mse::TAtomicRefCountingPointer<F> F_atomic_refcounting_ptr1 = EF_atomic_refcounting_ptr1;
+					assert(2 == F_atomic_refcounting_ptr1->f);
+					assert(static_cast<F*>(std::addressof(*EF_atomic_refcounting_ptr1)) == std::addressof(*F_atomic_refcounting_ptr1));
+					mse::TAtomicRefCountingConstPointer<EF> EF_atomic_refcounting_cptr1 = EF_atomic_refcounting_ptr1;
+					mse::TAtomicRefCountingConstPointer<F> F_atomic_refcounting_cptr1 = EF_atomic_refcounting_cptr1;
+					assert(std::addressof(*F_atomic_refcounting_ptr1) == std::addressof(*F_atomic_refcounting_cptr1));
+
+					mse::TAtomicRefCountingPointer<F> F_atomic_refcounting_ptr2 = mse::make_atomic_refcounting<EF>(&destruction_count);
+					F_atomic_refcounting_ptr2 = EF_atomic_refcounting_ptr1;
+					assert(1 == destruction_count);
+					assert(2 == F_atomic_refcounting_ptr2->f);
+
+					mse::TAtomicRefCountingConstPointer<F> F_atomic_refcounting_cptr2 = mse::TAtomicRefCountingConstPointer<EF>(mse::make_atomic_refcounting<EF>(&destruction_count));
+					F_atomic_refcounting_cptr2 = EF_atomic_refcounting_cptr1;
+					assert(2 == destruction_count);
+					assert(2 == F_atomic_refcounting_cptr2->f);
+				}
+				/* The last owning pointers were of base class type. */
+				assert(3 == destruction_count);
+			}
+
+#ifndef MSE_REFCOUNTINGPOINTER_DISABLED
+			{
+				/* When the last reference to a target is released by a thread other than the one that created it, the target
+				is queued for the creating thread to deallocate. */
+				std::atomic<int> destruction_count{ 0 };
+				auto F_atomic_refcounting_ptr1 = mse::make_nullable_atomic_refcounting<F>(&destruction_count);
+				auto F_atomic_refcounting_ptr2 = F_atomic_refcounting_ptr1;
+				F_atomic_refcounting_ptr1 = nullptr;
+				std::thread thread1([](mse::TAtomicRefCountingPointer<F> ptr) { ptr = nullptr; }, std::move(F_atomic_refcounting_ptr2));
+				thread1.join();
+				assert(0 == destruction_count);
+				mse::process_pending_atomic_refcounting_releases();
+				assert(1 == destruction_count);
+			}
+#endif // !MSE_REFCOUNTINGPOINTER_DISABLED
+
+			{
+				/* Once the creating thread has exited, the thread that releases the last reference deallocates the target
+				itself. */
+				std::atomic<int> destruction_count{ 0 };
+				mse::TAtomicRefCountingPointer<F> F_atomic_refcounting_ptr1;
+				std::thread thread1([&F_atomic_refcounting_ptr1, &destruction_count]() {
+					F_atomic_refcounting_ptr1 = mse::make_atomic_refcounting<F>(&destruction_count);
+				});
+				thread1.join();
+				assert(0 == destruction_count);
+				F_atomic_refcounting_ptr1 = nullptr;
+				assert(1 == destruction_count);
+			}
 #endif // MSE_SELF_TESTS
 		}
 	};
@@ -80,6 +80,9 @@ namespace mse {
 		template <class _Ty> void ndregistered_delete(const TNDRegisteredPointer<_Ty>& ndregisteredPtrRef);
 		template <class _Ty> void ndregistered_delete(const TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef);
 	}
+	template <class _Ty, class... Args> TNDRegisteredPointer<_Ty> ndregistered_new_pooled(Args&&... args);
+	template <class _Ty> void ndregistered_delete_pooled(const TNDRegisteredPointer<_Ty>& ndregisteredPtrRef);
+	template <class _Ty> void ndregistered_delete_pooled(const TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef);
 
 	namespace impl {
 		template<typename _Ty, class... Args>
@@ -150,6 +153,12 @@ namespace mse {
 			mse::registered_delete(regPtrRef);
 		}
 	}
+	template <class _Ty, class... Args>
+	TRegisteredPointer<_Ty> registered_new_pooled(Args&&... args) { return registered_new<_Ty>(std::forward<Args>(args)...); }
+	template <class _Ty>
+	void registered_delete_pooled(const TRegisteredPointer<_Ty>& regPtrRef) { registered_delete<_Ty>(regPtrRef); }
+	template <class _Ty>
+	void registered_delete_pooled(const TRegisteredConstPointer<_Ty>& regPtrRef) { registered_delete<_Ty>(regPtrRef); }
 
 	template <class X, class... Args>
 	auto make_registered(Args&&... args) {
@@ -187,6 +196,9 @@ namespace mse {
 		template <class _Ty> void registered_delete(TNDRegisteredPointer<_Ty>& ndregisteredPtrRef) { return mse::us::ndregistered_delete<_Ty>(ndregisteredPtrRef); }
 		template <class _Ty> void registered_delete(TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef) { return mse::us::ndregistered_delete<_Ty>(ndregisteredPtrRef); }
 	}
+	template <class _Ty, class... Args> TNDRegisteredPointer<_Ty> registered_new_pooled(Args&&... args) { return ndregistered_new_pooled<_Ty>(std::forward<Args>(args)...); }
+	template <class _Ty> void registered_delete_pooled(TNDRegisteredPointer<_Ty>& ndregisteredPtrRef) { return mse::ndregistered_delete_pooled<_Ty>(ndregisteredPtrRef); }
+	template <class _Ty> void registered_delete_pooled(TNDRegisteredConstPointer<_Ty>& ndregisteredPtrRef) { return mse::ndregistered_delete_pooled<_Ty>(ndregisteredPtrRef); }
 
 	template <class X, class... Args>
 	auto make_registered(Args&&... args) {
@@ -205,7 +217,7 @@ namespace mse {
 
 	namespace us {
 		namespace impl {
-			/* node of a (singly-linked) list of pointers */
+			/* node of a (singly-linked, or optionally doubly-linked) list of pointers */
 			class CRegisteredNode {
 			public:
 				virtual void rn_set_pointer_to_null() const = 0;
@@ -215,9 +227,24 @@ namespace mse {
 				const CRegisteredNode* get_next_ptr() const {
 					return m_next_ptr;
 				}
+#ifdef MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST
+				void set_prev_next_ptr_ptr(const CRegisteredNode** prev_next_ptr_ptr) const {
+					m_prev_next_ptr_ptr = prev_next_ptr_ptr;
+				}
+				const CRegisteredNode** get_prev_next_ptr_ptr() const {
+					return m_prev_next_ptr_ptr;
+				}
+				const CRegisteredNode** get_address_of_my_next_ptr() const {
+					return &m_next_ptr;
+				}
+#endif /*MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST*/
 
 			private:
 				mutable const CRegisteredNode * m_next_ptr = nullptr;
+#ifdef MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST
+				/* address of the "next" pointer of the previous node (or of the target object's head pointer) */
+				mutable const CRegisteredNode ** m_prev_next_ptr_ptr = nullptr;
+#endif /*MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST*/
 			};
 		}
 	}
@@ -595,6 +622,27 @@ namespace mse {
 		TNDRegisteredFixedConstPointer<_TROFLy> mse_registered_fptr() const { return TNDRegisteredFixedConstPointer<_TROFLy>(this); }
 
 		/* todo: make these private */
+#ifdef MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST
+		/* With the doubly-linked list, unregistering (i.e. retargeting or destroying) a pointer is always O(1), rather than
+		O(n) in the worst case, at the cost of an extra (native) pointer stored in each registered pointer. */
+		void register_pointer(const mse::us::impl::CRegisteredNode& node_cref) const {
+			if (m_head_ptr) {
+				m_head_ptr->set_prev_next_ptr_ptr(node_cref.get_address_of_my_next_ptr());
+			}
+			node_cref.set_next_ptr(m_head_ptr);
+			node_cref.set_prev_next_ptr_ptr(&m_head_ptr);
+			m_head_ptr = &node_cref;
+		}
+		void unregister_pointer(const mse::us::impl::CRegisteredNode& node_cref) const {
+			assert(node_cref.get_prev_next_ptr_ptr());
+			(*(node_cref.get_prev_next_ptr_ptr())) = node_cref.get_next_ptr();
+			if (node_cref.get_next_ptr()) {
+				node_cref.get_next_ptr()->set_prev_next_ptr_ptr(node_cref.get_prev_next_ptr_ptr());
+			}
+			node_cref.set_prev_next_ptr_ptr(nullptr);
+			node_cref.set_next_ptr(nullptr);
+		}
+#else /*MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST*/
 		void register_pointer(const mse::us::impl::CRegisteredNode& node_cref) const {
 			node_cref.set_next_ptr(m_head_ptr);
 			m_head_ptr = &node_cref;
@@ -621,19 +669,23 @@ namespace mse {
 			current_node_ptr->set_next_ptr(target_node_ptr->get_next_ptr());
 			node_cref.set_next_ptr(nullptr);
 		}
+#endif /*MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST*/
 
 	private:
 		void unregister_and_set_outstanding_pointers_to_null() const {
 			auto current_node_ptr = m_head_ptr;
 			while (current_node_ptr) {
 				current_node_ptr->rn_set_pointer_to_null();
+#ifdef MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST
+				current_node_ptr->set_prev_next_ptr_ptr(nullptr);
+#endif /*MSE_REGISTEREDPOINTER_USE_DOUBLY_LINKED_LIST*/
 				auto next_ptr = current_node_ptr->get_next_ptr();
 				current_node_ptr->set_next_ptr(nullptr);
 				current_node_ptr = next_ptr;
 			}
 		}
 
-		/* first node in a (singly-linked) list of pointers targeting this object */
+		/* first node in a (singly-linked, or optionally doubly-linked) list of pointers targeting this object */
 		mutable const mse::us::impl::CRegisteredNode * m_head_ptr = nullptr;
 	};
 
@@ -657,6 +709,32 @@ namespace mse {
 		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::registered_delete() \n- tip: If deleting via base class pointer, use mse::us::registered_delete() instead. ")); }
 		regPtrRef.registered_delete();
 	}
+
+	/* ndregistered_new_pooled<>() is like ndregistered_new<>() except that the memory for the object is drawn from a
+	thread_local pool specific to the object's type. Objects allocated this way must be deallocated with
+	ndregistered_delete_pooled<>() (which, like ndregistered_delete<>(), verifies that the object was allocated this way). */
+	template <class _Ty, class... Args>
+	TNDRegisteredPointer<_Ty> ndregistered_new_pooled(Args&&... args) {
+		auto a = mse::us::impl::pooled_new<TNDRegisteredObj<_Ty> >(std::forward<Args>(args)...);
+		mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDRegisteredObj<_Ty> > >().registerPointer(a);
+		return &(*a);
+	}
+	template <class _Ty>
+	void ndregistered_delete_pooled(const TNDRegisteredPointer<_Ty>& regPtrRef) {
+		auto a = static_cast<TNDRegisteredObj<_Ty>*>(regPtrRef);
+		auto res = mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDRegisteredObj<_Ty> > >().unregisterPointer(a);
+		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::registered_delete_pooled() \n- tip: Objects allocated with registered_new_pooled() must be deallocated with registered_delete_pooled() and vice versa. ")); }
+		mse::us::impl::pooled_delete(a);
+		assert(!regPtrRef);
+	}
+	template <class _Ty>
+	void ndregistered_delete_pooled(const TNDRegisteredConstPointer<_Ty>& regPtrRef) {
+		auto a = static_cast<const TNDRegisteredObj<_Ty>*>(regPtrRef);
+		auto res = mse::us::impl::tlSAllocRegistry_ref<mse::us::impl::TPooledAllocTag<TNDRegisteredObj<_Ty> > >().unregisterPointer(a);
+		if (!res) { assert(false); MSE_THROW(std::invalid_argument("invalid argument, no corresponding allocation found - mse::registered_delete_pooled() \n- tip: Objects allocated with registered_new_pooled() must be deallocated with registered_delete_pooled() and vice versa. ")); }
+		mse::us::impl::pooled_delete(a);
+		assert(!regPtrRef);
+	}
 	namespace us {
 		template <class _Ty>
 		void ndregistered_delete(const TNDRegisteredPointer<_Ty>& regPtrRef) {
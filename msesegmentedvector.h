@@ -0,0 +1,429 @@
+
+// Copyright (c) 2015 Noah Lopez
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+#ifndef MSESEGMENTEDVECTOR_H
+#define MSESEGMENTEDVECTOR_H
+
+#include "msemsevector.h"
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
+#pragma push_macro("MSE_THROW")
+#pragma push_macro("_NOEXCEPT")
+#pragma push_macro("_NOEXCEPT_OP")
+#endif // !MSE_PUSH_MACRO_NOT_SUPPORTED
+
+#ifdef MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) MSE_CUSTOM_THROW_DEFINITION(x)
+#else // MSE_CUSTOM_THROW_DEFINITION
+#define MSE_THROW(x) throw(x)
+#endif // MSE_CUSTOM_THROW_DEFINITION
+
+#ifndef _NOEXCEPT
+#define _NOEXCEPT
+#endif /*_NOEXCEPT*/
+
+#ifndef _NOEXCEPT_OP
+#define _NOEXCEPT_OP(x)	noexcept(x)
+#endif /*_NOEXCEPT_OP*/
+
+namespace mse {
+
+	class segmented_vector_range_error : public std::range_error {
+	public:
+		using std::range_error::range_error;
+	};
+
+	namespace impl {
+		namespace ns_segmented_vector {
+			/* By default, segments are (roughly) 4KB, but hold at least 16 elements. */
+			template<class _Ty>
+			struct default_segment_size : std::integral_constant<size_t, ((4096 / 16) >= sizeof(_Ty)) ? (4096 / sizeof(_Ty)) : 16> {};
+		}
+	}
+
+	/* segmented_vector<> is a vector that stores its elements in fixed-size segments (of _SegmentSize elements) rather
+	than in a single contiguous buffer. So growing the vector never moves existing elements (and never requires copying
+	the whole contents). Like stnii_vector<>, it does not expose any (unprotected) iterators, and direct (scope) pointers
+	to its elements are obtained via an "xscope_structure_lock_guard". But because element addresses are stable, a
+	structure lock only prevents operations that would remove (or replace) elements (like pop_back(), erase(), clear(),
+	shrinking resize() or assignment). Operations that add elements (like push_back(), emplace_back(), insert() or
+	growing resize()) remain permitted while the structure is locked. Note that insert() shifts the values of the
+	subsequent elements (the way std::vector<>'s insert() does), so while an element's address remains valid, the value
+	it holds may change. segmented_vector<> is not eligible to be shared between threads. */
+	template<class _Ty, size_t _SegmentSize = mse::impl::ns_segmented_vector::default_segment_size<_Ty>::value, class _A = std::allocator<_Ty> >
+	class segmented_vector : public us::impl::AsyncNotShareableTagBase, public us::impl::LockableStructureContainerTagBase {
+	public:
+		static_assert(1 <= _SegmentSize, "segmented_vector<> requires a segment size of at least one element");
+		typedef segmented_vector _Myt;
+		typedef _A allocator_type;
+		typedef _Ty value_type;
+		typedef size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef _Ty& reference;
+		typedef const _Ty& const_reference;
+		typedef _Ty* pointer;
+		typedef const _Ty* const_pointer;
+		static const size_type segment_size = _SegmentSize;
+
+		/* As with stnii_vector<>, the scope iterators hold a structure lock on the vector, so (scope) pointers to elements
+		can be obtained from them. */
+		typedef mse::impl::ns_gnii_vector::Tgnii_vector_xscope_cslsstrong_const_iterator_type<_Myt> xscope_const_iterator;
+		typedef mse::impl::ns_gnii_vector::Tgnii_vector_xscope_cslsstrong_iterator_type<_Myt> xscope_iterator;
+
+		explicit segmented_vector(const _A& _Al = _A()) : m_allocator(_Al), m_segments(segment_table_allocator_type(_Al)) {}
+		explicit segmented_vector(size_type _N, const _A& _Al = _A()) : segmented_vector(_Al) { resize(_N); }
+		segmented_vector(size_type _N, const _Ty& _V, const _A& _Al = _A()) : segmented_vector(_Al) { resize(_N, _V); }
+		template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+		segmented_vector(const _Iter& _First, const _Iter& _Last, const _A& _Al = _A()) : segmented_vector(_Al) { append(_First, _Last); }
+		segmented_vector(std::initializer_list<_Ty> _Ilist, const _A& _Al = _A()) : segmented_vector(_Al) { append(_Ilist.begin(), _Ilist.end()); }
+		segmented_vector(const _Myt& _X) : segmented_vector(alloc_traits::select_on_container_copy_construction(_X.m_allocator)) {
+			append_copy_of(_X);
+		}
+		segmented_vector(const _Myt& _X, const _A& _Al) : segmented_vector(_Al) { append_copy_of(_X); }
+		segmented_vector(_Myt&& _X) : m_allocator(_X.m_allocator), m_segments(segment_table_allocator_type(_X.m_allocator)) {
+			/* The source's contents are moved (rather than copied), so its structure must not be locked. */
+			structure_change_guard<decltype(_X.m_structure_change_mutex)> lock1(_X.m_structure_change_mutex);
+			take_contents_of(_X);
+		}
+		~segmented_vector() {
+			mse::impl::destructor_lock_guard1<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+
+			/* This is just a no-op function that will cause a compile error when _Ty is not an eligible type. */
+			valid_if_Ty_is_not_an_xscope_type();
+
+			destroy_tail(m_size);
+			release_unused_segments();
+		}
+
+		_Myt& operator=(const _Myt& _X) {
+			if (std::addressof(_X) == this) { return (*this); }
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			destroy_tail(m_size);
+			append_copy_of(_X);
+			return (*this);
+		}
+		_Myt& operator=(_Myt&& _X) {
+			if (std::addressof(_X) == this) { return (*this); }
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			structure_change_guard<decltype(_X.m_structure_change_mutex)> lock2(_X.m_structure_change_mutex);
+			destroy_tail(m_size);
+			if (m_allocator == _X.m_allocator) {
+				release_unused_segments();
+				take_contents_of(_X);
+			}
+			else {
+				reserve(_X.m_size);
+				for (size_type i = 0; i < _X.m_size; i += 1) { emplace_back(std::move(_X.element(i))); }
+				_X.destroy_tail(_X.m_size);
+			}
+			return (*this);
+		}
+		_Myt& operator=(std::initializer_list<_Ty> _Ilist) {
+			assign(_Ilist.begin(), _Ilist.end());
+			return (*this);
+		}
+		void assign(size_type _N, const _Ty& _V) {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			/* _V might be an element of this vector. */
+			_Ty value(_V);
+			destroy_tail(m_size);
+			reserve(_N);
+			while (m_size < _N) { emplace_back(value); }
+		}
+		template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+		void assign(const _Iter& _First, const _Iter& _Last) {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			destroy_tail(m_size);
+			append(_First, _Last);
+		}
+		void assign(std::initializer_list<_Ty> _Ilist) { assign(_Ilist.begin(), _Ilist.end()); }
+
+		size_type size() const _NOEXCEPT { return m_size; }
+		size_type capacity() const _NOEXCEPT { return m_segments.size() * _SegmentSize; }
+		size_type max_size() const _NOEXCEPT { return alloc_traits::max_size(m_allocator); }
+		bool empty() const _NOEXCEPT { return (0 == m_size); }
+		_A get_allocator() const _NOEXCEPT { return m_allocator; }
+
+		reference operator[](size_type _P) { return at(_P); }
+		const_reference operator[](size_type _P) const { return at(_P); }
+		reference at(size_type _P) {
+			if (m_size <= _P) { MSE_THROW(segmented_vector_range_error("index out of range - reference at() - segmented_vector")); }
+			return element(_P);
+		}
+		const_reference at(size_type _P) const {
+			if (m_size <= _P) { MSE_THROW(segmented_vector_range_error("index out of range - const_reference at() - segmented_vector")); }
+			return element(_P);
+		}
+		reference front() {
+			if (0 == m_size) { MSE_THROW(segmented_vector_range_error("front() on empty - reference front() - segmented_vector")); }
+			return element(0);
+		}
+		const_reference front() const {
+			if (0 == m_size) { MSE_THROW(segmented_vector_range_error("front() on empty - const_reference front() - segmented_vector")); }
+			return element(0);
+		}
+		reference back() {
+			if (0 == m_size) { MSE_THROW(segmented_vector_range_error("back() on empty - reference back() - segmented_vector")); }
+			return element(m_size - 1);
+		}
+		const_reference back() const {
+			if (0 == m_size) { MSE_THROW(segmented_vector_range_error("back() on empty - const_reference back() - segmented_vector")); }
+			return element(m_size - 1);
+		}
+
+		/* Operations that only add elements (or allocate segments) do not move any existing elements, so they are
+		permitted while the structure is locked. */
+		void reserve(size_type _Count) {
+			if (max_size() < _Count) { MSE_THROW(std::length_error("requested capacity too large - void reserve() - segmented_vector")); }
+			const auto required_number_of_segments = (_Count + (_SegmentSize - 1)) / _SegmentSize;
+			if (m_segments.size() < required_number_of_segments) {
+				m_segments.reserve(required_number_of_segments);
+				while (m_segments.size() < required_number_of_segments) { add_segment(); }
+			}
+		}
+		void push_back(const _Ty& _X) { emplace_back(_X); }
+		void push_back(_Ty&& _X) { emplace_back(std::move(_X)); }
+		template<class ..._Valty>
+		reference emplace_back(_Valty&& ..._Val) {
+			if (capacity() == m_size) {
+				add_segment();
+			}
+			auto& new_element_ref = element(m_size);
+			alloc_traits::construct(m_allocator, std::addressof(new_element_ref), std::forward<_Valty>(_Val)...);
+			m_size += 1;
+			return new_element_ref;
+		}
+		/* Insertions are implemented by appending the new elements and rotating them into place. No element is
+		removed, so they are permitted while the structure is locked. */
+		template<class ..._Valty>
+		void emplace(size_type pos, _Valty&& ..._Val) {
+			if (m_size < pos) { MSE_THROW(segmented_vector_range_error("index out of range - void emplace() - segmented_vector")); }
+			emplace_back(std::forward<_Valty>(_Val)...);
+			rotate_tail_into_place(pos, m_size - 1);
+		}
+		void insert(size_type pos, const _Ty& _X) { emplace(pos, _X); }
+		void insert(size_type pos, _Ty&& _X) { emplace(pos, std::move(_X)); }
+		void insert(size_type pos, size_type _Count, const _Ty& _X) {
+			if (m_size < pos) { MSE_THROW(segmented_vector_range_error("index out of range - void insert() - segmented_vector")); }
+			const auto original_size = m_size;
+			_Ty value(_X);
+			reserve(m_size + _Count);
+			while (m_size < original_size + _Count) { emplace_back(value); }
+			rotate_tail_into_place(pos, original_size);
+		}
+		template<class _Iter, class = mse::impl::_mse_RequireInputIter<_Iter> >
+		void insert(size_type pos, const _Iter& _First, const _Iter& _Last) {
+			if (m_size < pos) { MSE_THROW(segmented_vector_range_error("index out of range - void insert() - segmented_vector")); }
+			const auto original_size = m_size;
+			append(_First, _Last);
+			rotate_tail_into_place(pos, original_size);
+		}
+		void insert(size_type pos, std::initializer_list<_Ty> _Ilist) { insert(pos, _Ilist.begin(), _Ilist.end()); }
+
+		/* Operations that remove elements require that the structure not be locked. */
+		void pop_back() {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			if (0 == m_size) { MSE_THROW(segmented_vector_range_error("pop_back() on empty - void pop_back() - segmented_vector")); }
+			destroy_tail(1);
+		}
+		void erase(size_type pos) { erase(pos, pos + 1); }
+		void erase(size_type first, size_type last) {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			if ((last < first) || (m_size < last)) { MSE_THROW(segmented_vector_range_error("invalid arguments - void erase() - segmented_vector")); }
+			if (first == last) { return; }
+			for (size_type i = last; i < m_size; i += 1) {
+				element(first + (i - last)) = std::move(element(i));
+			}
+			destroy_tail(last - first);
+		}
+		void clear() {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			destroy_tail(m_size);
+		}
+		void resize(size_type _N) {
+			if (m_size > _N) {
+				structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+				destroy_tail(m_size - _N);
+			}
+			else {
+				reserve(_N);
+				while (m_size < _N) { emplace_back(); }
+			}
+		}
+		void resize(size_type _N, const _Ty& _X) {
+			if (m_size > _N) {
+				structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+				destroy_tail(m_size - _N);
+			}
+			else if (m_size < _N) {
+				/* _X might be an element of this vector. */
+				_Ty value(_X);
+				reserve(_N);
+				while (m_size < _N) { emplace_back(value); }
+			}
+		}
+		/* Releases any segments not holding elements. Existing elements are not affected. */
+		void shrink_to_fit() {
+			release_unused_segments();
+			m_segments.shrink_to_fit();
+		}
+		void swap(_Myt& _X) {
+			structure_change_guard<decltype(m_structure_change_mutex)> lock1(m_structure_change_mutex);
+			structure_change_guard<decltype(_X.m_structure_change_mutex)> lock2(_X.m_structure_change_mutex);
+			std::swap(m_allocator, _X.m_allocator);
+			m_segments.swap(_X.m_segments);
+			std::swap(m_size, _X.m_size);
+		}
+
+		friend bool operator==(const _Myt& _Left, const _Myt& _Right) {
+			if (_Left.size() != _Right.size()) { return false; }
+			for (size_type i = 0; i < _Left.size(); i += 1) {
+				if (!(_Left.element(i) == _Right.element(i))) { return false; }
+			}
+			return true;
+		}
+		friend bool operator!=(const _Myt& _Left, const _Myt& _Right) { return !(_Left == _Right); }
+		friend bool operator<(const _Myt& _Left, const _Myt& _Right) {
+			const auto common_size = (std::min)(_Left.size(), _Right.size());
+			for (size_type i = 0; i < common_size; i += 1) {
+				if (_Left.element(i) < _Right.element(i)) { return true; }
+				if (_Right.element(i) < _Left.element(i)) { return false; }
+			}
+			return (_Left.size() < _Right.size());
+		}
+		friend bool operator>(const _Myt& _Left, const _Myt& _Right) { return (_Right < _Left); }
+		friend bool operator<=(const _Myt& _Left, const _Myt& _Right) { return !(_Right < _Left); }
+		friend bool operator>=(const _Myt& _Left, const _Myt& _Right) { return !(_Left < _Right); }
+
+	private:
+		typedef std::allocator_traits<_A> alloc_traits;
+		typedef typename alloc_traits::template rebind_alloc<pointer> segment_table_allocator_type;
+
+		/* If _Ty is an xscope type, then the following member function will not instantiate, causing an
+		(intended) compile error. */
+		template<class _Ty2 = _Ty, class = typename std::enable_if<(std::is_same<_Ty2, _Ty>::value) && (mse::impl::is_potentially_not_xscope<_Ty2>::value), void>::type>
+		void valid_if_Ty_is_not_an_xscope_type() const {}
+
+		reference element(size_type _P) { return m_segments[_P / _SegmentSize][_P % _SegmentSize]; }
+		const_reference element(size_type _P) const { return m_segments[_P / _SegmentSize][_P % _SegmentSize]; }
+
+		void add_segment() {
+			/* Grow the segment table geometrically, and before allocating the segment, so that the push_back() won't
+			throw (and leak the segment). */
+			if (m_segments.capacity() <= m_segments.size()) {
+				m_segments.reserve((std::max)(2 * m_segments.size(), m_segments.size() + 1));
+			}
+			m_segments.push_back(alloc_traits::allocate(m_allocator, _SegmentSize));
+		}
+		void release_unused_segments() _NOEXCEPT {
+			const auto number_of_used_segments = (m_size + (_SegmentSize - 1)) / _SegmentSize;
+			while (m_segments.size() > number_of_used_segments) {
+				alloc_traits::deallocate(m_allocator, m_segments.back(), _SegmentSize);
+				m_segments.pop_back();
+			}
+		}
+		void destroy_tail(size_type count) _NOEXCEPT {
+			for (; 0 < count; count -= 1) {
+				m_size -= 1;
+				alloc_traits::destroy(m_allocator, std::addressof(element(m_size)));
+			}
+		}
+		/* Rotates the elements in the range [first_new_index, m_size) to position pos (by reversing the two ranges and
+		then the combined range). */
+		void rotate_tail_into_place(size_type pos, size_type first_new_index) {
+			reverse_range(pos, first_new_index);
+			reverse_range(first_new_index, m_size);
+			reverse_range(pos, m_size);
+		}
+		void reverse_range(size_type first, size_type last) {
+			using std::swap;
+			for (; (first < last) && (first < last - 1); first += 1, last -= 1) {
+				swap(element(first), element(last - 1));
+			}
+		}
+		template<class _Iter>
+		void append(const _Iter& _First, const _Iter& _Last) {
+			for (auto it = _First; _Last != it; ++it) { emplace_back(*it); }
+		}
+		void append_copy_of(const _Myt& _X) {
+			reserve(m_size + _X.m_size);
+			for (size_type i = 0; i < _X.m_size; i += 1) { emplace_back(_X.element(i)); }
+		}
+		/* Assumes this vector is empty and holds no segments. */
+		void take_contents_of(_Myt& _X) _NOEXCEPT {
+			m_segments.swap(_X.m_segments);
+			m_size = _X.m_size;
+			_X.m_size = 0;
+		}
+
+		template<typename _Mutex>
+		class structure_change_guard {
+		public:
+			structure_change_guard(_Mutex& _Mtx) MSE_FUNCTION_TRY : m_lock_guard(_Mtx) {}
+			MSE_FUNCTION_CATCH_ANY {
+				MSE_THROW(mse::structure_lock_violation_error("structure lock violation - Attempting to remove \
+					elements from a segmented_vector while a reference (iterator) to one of its elements still exists?"));
+			}
+		private:
+			std::lock_guard<_Mutex> m_lock_guard;
+		};
+
+		_A m_allocator;
+		std::vector<pointer, segment_table_allocator_type> m_segments;
+		size_type m_size = 0;
+
+		mutable mse::non_thread_safe_shared_mutex m_structure_change_mutex;
+
+		friend class mse::us::impl::Txscope_structure_lock_guard<_Myt>;
+		friend class mse::us::impl::Txscope_const_structure_lock_guard<_Myt>;
+	};
+
+	template<class _Ty, size_t _SegmentSize, class _A>
+	void swap(segmented_vector<_Ty, _SegmentSize, _A>& _Left, segmented_vector<_Ty, _SegmentSize, _A>& _Right) {
+		_Left.swap(_Right);
+	}
+
+	/* While an instance of xscope_structure_lock_guard exists it ensures that direct (scope) pointers to individual
+	elements in the segmented_vector do not become invalid by preventing any operation that might remove elements. Any
+	attempt to execute such an operation would result in an exception. Unlike with the other vectors, adding elements
+	remains permitted. */
+	/* The returned xscope_structure_lock_guard constructed from a const reference is only safe because
+	segmented_vector<> is not eligible to be shared between threads. */
+	template<class _Ty, size_t _SegmentSize, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedConstPointer<segmented_vector<_Ty, _SegmentSize, _A> >& owner_ptr) {
+		return mse::us::impl::ns_gnii_vector::xscope_const_structure_lock_guard<segmented_vector<_Ty, _SegmentSize, _A> >(owner_ptr);
+	}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template<class _Ty, size_t _SegmentSize, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedConstPointer<segmented_vector<_Ty, _SegmentSize, _A> >& owner_ptr) {
+		return mse::us::impl::ns_gnii_vector::xscope_const_structure_lock_guard<segmented_vector<_Ty, _SegmentSize, _A> >(owner_ptr);
+	}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+
+	template<class _Ty, size_t _SegmentSize, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeObjFixedPointer<segmented_vector<_Ty, _SegmentSize, _A> >& owner_ptr) {
+		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<segmented_vector<_Ty, _SegmentSize, _A> >(owner_ptr);
+	}
+#if !defined(MSE_SCOPEPOINTER_DISABLED)
+	template<class _Ty, size_t _SegmentSize, class _A>
+	auto make_xscope_structure_lock_guard(const mse::TXScopeFixedPointer<segmented_vector<_Ty, _SegmentSize, _A> >& owner_ptr) {
+		return mse::impl::ns_gnii_vector::xscope_structure_lock_guard<segmented_vector<_Ty, _SegmentSize, _A> >(owner_ptr);
+	}
+#endif // !defined(MSE_SCOPEPOINTER_DISABLED)
+}
+
+#ifndef MSE_PUSH_MACRO_NOT_SUPPORTED
+#pragma pop_macro("MSE_THROW")
+#pragma pop_macro("_NOEXCEPT")
+#pragma pop_macro("_NOEXCEPT_OP")
+#endif // !MSE_PUSH_MACRO_NOT_SUPPORTED
+
+#endif /*ndef MSESEGMENTEDVECTOR_H*/
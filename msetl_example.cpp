@@ -246,23 +246,82 @@ int main(int argc, char* argv[]) {
 		vvi.clear();
 
 #if !defined(MSE_MSTDVECTOR_DISABLED) && !defined(MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE)
+		bool expected_exception_thrown = false;
 		MSE_TRY {
-			/* At this point, the vint_type object is cleared from vvi, but (with the current library implementation) it has
-			not actually been deallocated/destructed yet because it "knows" that there is an iterator, namely vi_it, that is
-			still referencing it. It will be deallocated when there are no more iterators referencing it. */
-			auto value = (*vi_it); /* In debug mode this will fail an assert. In non-debug mode it'll just work (safely). */
-			assert(5 == value);
+			/* At this point, the vint_type object has been cleared from vvi and destroyed. vi_it "knows" that its target
+			vector no longer exists, so any attempt to use it will be detected. */
+			auto value = (*vi_it); /* This will throw an exception. (In debug mode, unless
+			MSE_SUPPRESS_MSTD_VECTOR_CHECK_USE_AFTER_FREE is defined, it will fail an assert first.) */
+		}
+		MSE_CATCH(const mse::mstd::mstdvector_use_after_free_error&) {
+			expected_exception_thrown = true;
 			vint_type vi2;
+			/* vi_it can still be (re)assigned though. */
 			vi_it = vi2.begin();
-			/* The vint_type object that vi_it was originally pointing to is now deallocated/destructed, because vi_it no longer
-			references it. */
 		}
-		MSE_CATCH_ANY {
-			/* At present, no exception will be thrown. With future library implementations, maybe. */
-			std::cerr << "potentially expected exception" << std::endl;
+		assert(expected_exception_thrown);
+#endif // !defined(MSE_MSTDVECTOR_DISABLED) && !defined(MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE)
+	}
+
+#ifdef MSE_HAS_MEMORY_RESOURCE
+	{
+		/* The library's vectors and strings are allocator-aware, and the mse::pmr namespace provides versions of them that
+		use std::pmr::polymorphic_allocator<>. So, for example, they can share a std::pmr::monotonic_buffer_resource with
+		std::pmr containers. */
+		char buffer1[4096];
+		std::pmr::monotonic_buffer_resource arena1(buffer1, sizeof(buffer1));
+
+		mse::pmr::vector<mse::pmr::string> vector1(&arena1);
+		vector1.emplace_back("some text");
+		vector1.push_back(mse::pmr::string("some other text", &arena1));
+		/* As with std::pmr containers, the elements are constructed using the container's memory resource. */
+		assert(&arena1 == vector1.back().get_allocator().resource());
+
+		auto iter1 = vector1.begin();
+		assert(mse::pmr::string("some text", &arena1) == *iter1);
+
+		mse::pmr::nii_vector<int> nii_vector1(&arena1);
+		nii_vector1.push_back(1);
+
+#if !defined(MSE_MSTDVECTOR_DISABLED) && !defined(MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE)
+		/* An iterator may outlive not just its vector, but also the vector's memory resource. Any attempt to use it is
+		still detected. */
+		mse::pmr::vector<int>::iterator iter2;
+		{
+			std::pmr::monotonic_buffer_resource arena2;
+			mse::pmr::vector<int> vector2(&arena2);
+			vector2.push_back(5);
+			iter2 = vector2.begin();
 		}
+		bool expected_exception_thrown = false;
+		MSE_TRY {
+			auto value = (*iter2);
+		}
+		MSE_CATCH(const mse::mstd::mstdvector_use_after_free_error&) {
+			expected_exception_thrown = true;
+		}
+		assert(expected_exception_thrown);
 #endif // !defined(MSE_MSTDVECTOR_DISABLED) && !defined(MSE_MSTD_VECTOR_CHECK_USE_AFTER_FREE)
+
+#if !defined(MSE_MSTDSTRING_DISABLED) && !defined(MSE_MSTD_STRING_CHECK_USE_AFTER_FREE)
+		/* Likewise with string iterators. */
+		mse::pmr::string::iterator iter3;
+		{
+			std::pmr::monotonic_buffer_resource arena3;
+			mse::pmr::string string3("a string too long to fit in the string object's internal buffer", &arena3);
+			iter3 = string3.begin();
+		}
+		bool expected_exception_thrown3 = false;
+		MSE_TRY {
+			auto value = (*iter3);
+		}
+		MSE_CATCH(const std::out_of_range&) {
+			expected_exception_thrown3 = true;
+		}
+		assert(expected_exception_thrown3);
+#endif // !defined(MSE_MSTDSTRING_DISABLED) && !defined(MSE_MSTD_STRING_CHECK_USE_AFTER_FREE)
 	}
+#endif // MSE_HAS_MEMORY_RESOURCE
 
 	{
 		/* If the vector is declared as a "scope" object (which basically indicates that it is declared
@@ -375,6 +434,50 @@ int main(int argc, char* argv[]) {
 		/* mse::us::msevector<> also provides "safe" (bounds checked) versions of the original stl::vector iterators. */
 		std::sort(v.ss_begin(), v.ss_end());
 
+		{
+			/* If you need "registered" pointers to elements of a vector, rather than storing the elements as
+			TRegisteredObj<>s (which adds per-element overhead), you can obtain "element handles" that are tracked by the
+			vector itself. Like ipointers, element handles continue to point to the same item upon insert or delete, but
+			become null if the item they point to is removed (or the vector is destroyed). */
+			mse::us::msevector<int> v2 = v1;
+			mse::us::msevector<int>::element_handle eh1 = v2.make_element_handle(2);
+			assert(3 == (*eh1));
+			v2.erase(v2.begin());
+			assert(3 == (*eh1)); /* eh1 continues to point to the same item, not the same position */
+			assert(1 == eh1.position());
+			mse::us::msevector<int>::const_element_handle ceh1 = eh1;
+			v2.erase(v2.begin() + 1);
+			assert(!eh1); /* the target item has been removed */
+			assert(!ceh1);
+			v2.push_back(5);
+			assert(!eh1); /* and the handle remains null */
+
+#ifndef MSE_MSTDVECTOR_DISABLED
+			mse::mstd::vector<int> mv1 = { 1, 2, 3 };
+			auto meh1 = mv1.make_element_handle(1);
+			mv1.insert(mv1.begin(), 0);
+			assert(2 == (*meh1));
+			*meh1 = 7;
+			assert(7 == mv1[2]);
+#endif // !MSE_MSTDVECTOR_DISABLED
+		}
+
+		{
+			/* When making many inserts or erasures at once, insert_many() and erase_many() move each element (at most)
+			once and update any ipointers and element handles in a single sweep, rather than once per insert or erase.
+			The given indices refer to positions in the vector before any of the changes. */
+			mse::us::msevector<int> v2 = { 10, 20, 30, 40 };
+			auto eh1 = v2.make_element_handle(2);
+			v2.insert_many({ { 4, 45 }, { 0, 5 }, { 2, 25 }, { 2, 26 } });
+			assert((mse::us::msevector<int>{ 5, 10, 20, 25, 26, 30, 40, 45 }) == v2);
+			assert(5 == eh1.position());
+			v2.erase_many({ 0, 3, 4, 7 });
+			assert((mse::us::msevector<int>{ 10, 20, 30, 40 }) == v2);
+			assert(30 == (*eh1));
+			v2.erase_many({ 2 });
+			assert(!eh1);
+		}
+
 		/* mse::ivector<> is another vector for when safety and "correctness" are more of a priority than performance
 		or compatibility. It is completely safe like mse::mstd::vector<> but only supports the "ipointer" iterators.
 		It does not support the (problematic) standard vector iterator behavior. */
@@ -1082,6 +1185,7 @@ int main(int argc, char* argv[]) {
 		bool TRefCountingPointer_test1_res = TRefCountingPointer_test1.testBehaviour();
 		TRefCountingPointer_test1_res &= TRefCountingPointer_test1.testLinked();
 		TRefCountingPointer_test1.test1();
+		TRefCountingPointer_test1.test2();
 	}
 
 	{
@@ -1884,6 +1988,27 @@ with the library's (safe) optional<> types. The compiler has no problem with it,
 				}
 				std::cout << std::endl;
 			}
+			{
+				int count = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < number_of_loops; i += 1) {
+					mse::TRefCountingNotNullPointer<CE> owner_ptr = mse::make_refcounting_pooled<CE>(count);
+					if (0 == (i % 2)) {
+						(*owner_ptr).increment();
+					}
+					else {
+						(*owner_ptr).decrement();
+					}
+				}
+
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TRefCountingPointer (pooled): " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
 			{
 				int count = 0;
 				auto t1 = std::chrono::high_resolution_clock::now();
@@ -1947,6 +2072,72 @@ with the library's (safe) optional<> types. The compiler has no problem with it,
 				}
 				std::cout << std::endl;
 			}
+			{
+				int count = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < number_of_loops; i += 1) {
+					auto owner_ptr = mse::registered_new<CE>(count);
+					if (0 == (i % 2)) {
+						(*owner_ptr).increment();
+					}
+					else {
+						(*owner_ptr).decrement();
+					}
+					mse::registered_delete<CE>(owner_ptr);
+				}
+
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::registered_new(): " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
+			{
+				int count = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < number_of_loops; i += 1) {
+					auto owner_ptr = mse::registered_new_pooled<CE>(count);
+					if (0 == (i % 2)) {
+						(*owner_ptr).increment();
+					}
+					else {
+						(*owner_ptr).decrement();
+					}
+					mse::registered_delete_pooled<CE>(owner_ptr);
+				}
+
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::registered_new_pooled(): " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
+			{
+				int count = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < number_of_loops; i += 1) {
+					auto owner_ptr = mse::norad_new_pooled<CE>(count);
+					if (0 == (i % 2)) {
+						(*owner_ptr).increment();
+					}
+					else {
+						(*owner_ptr).decrement();
+					}
+					mse::norad_delete_pooled<CE>(owner_ptr);
+				}
+
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::norad_new_pooled(): " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
 			std::cout << std::endl;
 		}
 
@@ -2092,6 +2283,47 @@ with the library's (safe) optional<> types. The compiler has no problem with it,
 				}
 				std::cout << std::endl;
 			}
+			{
+				class CF {
+				public:
+					CF(int a = 0) : m_a(a) {}
+					int m_a = 3;
+				};
+				mse::TCRegisteredObj<CF> item1(1);
+				mse::TCRegisteredPointer<CF> item1_ptr = &item1;
+				{
+					auto t1 = std::chrono::high_resolution_clock::now();
+					for (int i = 0; i < number_of_loops2; i += 1) {
+						item1_ptr->m_a += (i & 1);
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TCRegisteredPointer (checked) repeated dereferencing: " << time_span.count() << " seconds.";
+					if (3 == item1_ptr->m_a) {
+						std::cout << " "; /* Using item1_ptr->m_a for (potential) output should prevent the optimizer from discarding too much. */
+					}
+					std::cout << std::endl;
+				}
+				{
+					auto t1 = std::chrono::high_resolution_clock::now();
+					{
+						/* The pin ensures that the target remains valid for the pin's lifetime, so the scope pointer obtained
+						from it can be dereferenced without any checks. */
+						auto item1_pin = mse::make_xscope_cregistered_pin(item1_ptr);
+						auto item1_xscpptr = item1_pin.xscope_ptr();
+						for (int i = 0; i < number_of_loops2; i += 1) {
+							item1_xscpptr->m_a += (i & 1);
+						}
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TCRegisteredPointer pinned repeated dereferencing: " << time_span.count() << " seconds.";
+					if (3 == item1_ptr->m_a) {
+						std::cout << " "; /* Using item1_ptr->m_a for (potential) output should prevent the optimizer from discarding too much. */
+					}
+					std::cout << std::endl;
+				}
+			}
 			{
 				class CF {
 				public:
@@ -2147,6 +2379,781 @@ with the library's (safe) optional<> types. The compiler has no problem with it,
 			}
 			std::cout << std::endl;
 		}
+
+		{
+			std::cout << "unregistering pointers from a target with many inbound pointers (oldest pointer first): \n";
+			for (size_t number_of_inbound_pointers = 10; number_of_inbound_pointers <= 10000; number_of_inbound_pointers *= 10) {
+				{
+					int count = 0;
+					mse::TRegisteredObj<CE> object1(count);
+					std::vector<mse::TRegisteredPointer<CE> > ptrs(number_of_inbound_pointers);
+					for (auto& ptr : ptrs) {
+						ptr = &object1;
+					}
+					auto t1 = std::chrono::high_resolution_clock::now();
+					for (auto& ptr : ptrs) {
+						ptr = nullptr;
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TRegisteredPointer (" << number_of_inbound_pointers << " pointers): " << time_span.count() << " seconds.";
+					std::cout << std::endl;
+				}
+				{
+					int count = 0;
+					mse::TCRegisteredObj<CE> object1(count);
+					std::vector<mse::TCRegisteredPointer<CE> > ptrs(number_of_inbound_pointers);
+					for (auto& ptr : ptrs) {
+						ptr = &object1;
+					}
+					auto t1 = std::chrono::high_resolution_clock::now();
+					for (auto& ptr : ptrs) {
+						ptr = nullptr;
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TCRegisteredPointer (" << number_of_inbound_pointers << " pointers): " << time_span.count() << " seconds.";
+					std::cout << std::endl;
+				}
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			std::cout << "destroying a target with many inbound pointers: \n";
+			for (size_t number_of_inbound_pointers = 10; number_of_inbound_pointers <= 10000; number_of_inbound_pointers *= 10) {
+				int count = 0;
+				auto object_ptr = std::make_unique<mse::TCRegisteredObj<CE> >(count);
+				std::vector<mse::TCRegisteredPointer<CE> > ptrs(number_of_inbound_pointers);
+				for (auto& ptr : ptrs) {
+					ptr = &(*object_ptr);
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				object_ptr = nullptr;
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TCRegisteredObj (" << number_of_inbound_pointers << " pointers): " << time_span.count() << " seconds.";
+				if (ptrs.front()) {
+					std::cout << " dangling pointer not detected."; /* Checking the (now dangling) pointer should prevent the optimizer from discarding too much. */
+				}
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			std::cout << "registered_new() and registered_delete() with many live allocations: \n";
+#ifndef NDEBUG
+			static const size_t max_number_of_live_allocations = 10000/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t max_number_of_live_allocations = 1000000/*arbitrary*/;
+#endif // !NDEBUG
+			for (size_t number_of_live_allocations = 10; number_of_live_allocations <= max_number_of_live_allocations; number_of_live_allocations *= 10) {
+				int count = 0;
+				std::vector<mse::TRegisteredPointer<CE> > ptrs(number_of_live_allocations);
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (auto& ptr : ptrs) {
+					ptr = mse::registered_new<CE>(count);
+				}
+				for (auto& ptr : ptrs) {
+					mse::registered_delete<CE>(ptr);
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::registered_new() (" << number_of_live_allocations << " live allocations): " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
+#ifdef MSE_SALLOC_REGISTRY_STATS
+			/* With MSE_SALLOC_REGISTRY_STATS defined, you can report (per type) statistics of the allocation registries used
+			by registered_new() and registered_delete(), for example, to help tune MSE_SALLOC_REGISTRY_FS1_MAX_OBJECTS. */
+			mse::write_salloc_registry_stats(std::cout);
+#endif // MSE_SALLOC_REGISTRY_STATS
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_objects = 10000/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_objects = 1000000/*arbitrary*/;
+#endif // !NDEBUG
+			std::cout << "final release of " << number_of_objects << " target objects: \n";
+			{
+				int count = 0;
+				std::vector<mse::TRefCountingPointer<CE> > ptrs(number_of_objects);
+				for (auto& ptr : ptrs) {
+					ptr = mse::make_refcounting<CE>(count);
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (auto& ptr : ptrs) {
+					ptr = nullptr;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TRefCountingPointer: " << time_span.count() << " seconds.";
+#if !defined(MSE_REFCOUNTINGPOINTER_DISABLED)
+				/* The memory overhead (per target object) of the reference counter. */
+				std::cout << " overhead per object: " << (sizeof(mse::TRefWithTargetObj<CE>) - sizeof(CE)) << " bytes.";
+#endif // !defined(MSE_REFCOUNTINGPOINTER_DISABLED)
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
+			{
+				int count = 0;
+				std::vector<std::shared_ptr<CE> > ptrs(number_of_objects);
+				for (auto& ptr : ptrs) {
+					ptr = std::make_shared<CE>(count);
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (auto& ptr : ptrs) {
+					ptr = nullptr;
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "std::shared_ptr: " << time_span.count() << " seconds.";
+				if (0 != count) {
+					std::cout << " destructions pending: " << count << "."; /* Using the count variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			static const int number_of_threads = 4/*arbitrary*/;
+			std::cout << "pointer copy and assignment under contention (" << number_of_threads << " threads): \n";
+			/* The target type needs to be "marked" as safe to share among threads. */
+			class CAtomicCount {
+			public:
+				void increment() const { m_count.fetch_add(1, std::memory_order_relaxed); }
+				int count() const { return m_count.load(); }
+				void async_shareable_and_passable_tag() const {}
+			private:
+				mutable std::atomic<int> m_count{ 0 };
+			};
+			{
+				class CB {
+				public:
+					static void copy_and_assign(mse::TAsyncNoradPointer<CAtomicCount> obj_ptr) {
+						mse::TAsyncNoradPointer<CAtomicCount> item_ptr2 = obj_ptr;
+						for (int i = 0; i < number_of_loops; i += 1) {
+							mse::TAsyncNoradPointer<CAtomicCount> item_ptr = obj_ptr;
+							item_ptr2 = item_ptr;
+							(*item_ptr2).increment();
+						}
+					}
+				};
+				mse::TAsyncNoradObj<CAtomicCount> object1;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					std::list<mse::mstd::thread> threads;
+					for (int i = 0; i < number_of_threads; i += 1) {
+						threads.emplace_back(mse::mstd::thread(CB::copy_and_assign, mse::TAsyncNoradPointer<CAtomicCount>(&object1)));
+					}
+					for (auto& thread : threads) {
+						thread.join();
+					}
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "mse::TAsyncNoradPointer: " << time_span.count() << " seconds.";
+				if (number_of_threads * number_of_loops != object1.count()) {
+					std::cout << " unexpected count: " << object1.count() << ".";
+				}
+				std::cout << std::endl;
+			}
+			{
+				class CB {
+				public:
+					static void copy_and_assign(std::shared_ptr<CAtomicCount> obj_ptr) {
+						std::shared_ptr<CAtomicCount> item_ptr2 = obj_ptr;
+						for (int i = 0; i < number_of_loops; i += 1) {
+							std::shared_ptr<CAtomicCount> item_ptr = obj_ptr;
+							item_ptr2 = item_ptr;
+							(*item_ptr2).increment();
+						}
+					}
+				};
+				auto object1_ptr = std::make_shared<CAtomicCount>();
+				auto t1 = std::chrono::high_resolution_clock::now();
+				{
+					std::list<std::thread> threads;
+					for (int i = 0; i < number_of_threads; i += 1) {
+						threads.emplace_back(std::thread(CB::copy_and_assign, object1_ptr));
+					}
+					for (auto& thread : threads) {
+						thread.join();
+					}
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+				std::cout << "std::shared_ptr: " << time_span.count() << " seconds.";
+				if (number_of_threads * number_of_loops != (*object1_ptr).count()) {
+					std::cout << " unexpected count: " << (*object1_ptr).count() << ".";
+				}
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		{
+			std::cout << "copy and assignment of pointers to thread-created targets (same total number of loops, spread across threads): \n";
+			/* The target type is "marked" as safe to share among threads. */
+			class CAtomicCount {
+			public:
+				void increment() const { m_count.fetch_add(1, std::memory_order_relaxed); }
+				void add(int n) const { m_count.fetch_add(n, std::memory_order_relaxed); }
+				int count() const { return m_count.load(); }
+				void async_shareable_and_passable_tag() const {}
+			private:
+				mutable std::atomic<int> m_count{ 0 };
+			};
+#ifndef NDEBUG
+			static const int max_number_of_threads = 8/*arbitrary*/;
+#else // !NDEBUG
+			static const int max_number_of_threads = 64/*arbitrary*/;
+#endif // !NDEBUG
+#ifndef MSE_REFCOUNTINGPOINTER_DISABLED
+			/* mse::mstd::thread verifies that its arguments (here, mse::TAtomicRefCountingPointer<>s) are safe to pass to
+			another thread. */
+			typedef mse::mstd::thread atomic_refcounting_thread_t;
+#else // !MSE_REFCOUNTINGPOINTER_DISABLED
+			/* Here mse::TAtomicRefCountingPointer<> is just an alias of std::shared_ptr<>, which mse::mstd::thread doesn't
+			recognize as safe to pass to another thread. */
+			typedef std::thread atomic_refcounting_thread_t;
+#endif // !MSE_REFCOUNTINGPOINTER_DISABLED
+			for (int number_of_threads = 1; number_of_threads <= max_number_of_threads; number_of_threads *= 2) {
+				const int number_of_loops_per_thread = number_of_loops / number_of_threads;
+				{
+					class CB {
+					public:
+						static void copy_and_assign(mse::TAtomicRefCountingPointer<CAtomicCount> total_ptr, int number_of_loops_per_thread) {
+							/* Pointers to targets created by this thread don't require atomic operations. */
+							auto obj_ptr = mse::make_atomic_refcounting<CAtomicCount>();
+							mse::TAtomicRefCountingPointer<CAtomicCount> item_ptr2 = obj_ptr;
+							for (int i = 0; i < number_of_loops_per_thread; i += 1) {
+								mse::TAtomicRefCountingPointer<CAtomicCount> item_ptr = obj_ptr;
+								item_ptr2 = item_ptr;
+								(*item_ptr2).increment();
+							}
+							(*total_ptr).add((*obj_ptr).count());
+						}
+					};
+					auto total_ptr = mse::make_atomic_refcounting<CAtomicCount>();
+					auto t1 = std::chrono::high_resolution_clock::now();
+					{
+						std::list<atomic_refcounting_thread_t> threads;
+						for (int i = 0; i < number_of_threads; i += 1) {
+							threads.emplace_back(atomic_refcounting_thread_t(CB::copy_and_assign, total_ptr, number_of_loops_per_thread));
+						}
+						for (auto& thread : threads) {
+							thread.join();
+						}
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TAtomicRefCountingPointer (" << number_of_threads << " threads): " << time_span.count() << " seconds.";
+					if (number_of_threads * number_of_loops_per_thread != (*total_ptr).count()) {
+						std::cout << " unexpected count: " << (*total_ptr).count() << ".";
+					}
+					std::cout << std::endl;
+				}
+				{
+					class CB {
+					public:
+						static void copy_and_assign(std::shared_ptr<CAtomicCount> total_ptr, int number_of_loops_per_thread) {
+							auto obj_ptr = std::make_shared<CAtomicCount>();
+							std::shared_ptr<CAtomicCount> item_ptr2 = obj_ptr;
+							for (int i = 0; i < number_of_loops_per_thread; i += 1) {
+								std::shared_ptr<CAtomicCount> item_ptr = obj_ptr;
+								item_ptr2 = item_ptr;
+								(*item_ptr2).increment();
+							}
+							(*total_ptr).add((*obj_ptr).count());
+						}
+					};
+					auto total_ptr = std::make_shared<CAtomicCount>();
+					auto t1 = std::chrono::high_resolution_clock::now();
+					{
+						std::list<std::thread> threads;
+						for (int i = 0; i < number_of_threads; i += 1) {
+							threads.emplace_back(std::thread(CB::copy_and_assign, total_ptr, number_of_loops_per_thread));
+						}
+						for (auto& thread : threads) {
+							thread.join();
+						}
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "std::shared_ptr (" << number_of_threads << " threads): " << time_span.count() << " seconds.";
+					if (number_of_threads * number_of_loops_per_thread != (*total_ptr).count()) {
+						std::cout << " unexpected count: " << (*total_ptr).count() << ".";
+					}
+					std::cout << std::endl;
+				}
+			}
+			std::cout << std::endl;
+
+			std::cout << "copy and assignment of pointers to a target shared by all threads (same total number of loops, spread across threads): \n";
+			for (int number_of_threads = 1; number_of_threads <= max_number_of_threads; number_of_threads *= 2) {
+				const int number_of_loops_per_thread = number_of_loops / number_of_threads;
+				{
+					class CB {
+					public:
+						static void copy_and_assign(mse::TAtomicRefCountingPointer<CAtomicCount> shared_obj_ptr, int number_of_loops_per_thread) {
+							/* The target was created by another thread, so every reference count operation here is atomic. And
+							shared_obj_ptr itself was copied in the creating thread but is released in this one. */
+							mse::TAtomicRefCountingPointer<CAtomicCount> item_ptr2 = shared_obj_ptr;
+							for (int i = 0; i < number_of_loops_per_thread; i += 1) {
+								mse::TAtomicRefCountingPointer<CAtomicCount> item_ptr = shared_obj_ptr;
+								item_ptr2 = item_ptr;
+								(*item_ptr2).increment();
+							}
+						}
+					};
+					auto shared_obj_ptr = mse::make_nullable_atomic_refcounting<CAtomicCount>();
+					auto shared_obj_cptr = mse::TAtomicRefCountingConstPointer<CAtomicCount>(shared_obj_ptr);
+					auto t1 = std::chrono::high_resolution_clock::now();
+					{
+						std::list<atomic_refcounting_thread_t> threads;
+						for (int i = 0; i < number_of_threads; i += 1) {
+							threads.emplace_back(atomic_refcounting_thread_t(CB::copy_and_assign, shared_obj_ptr, number_of_loops_per_thread));
+						}
+						/* Releasing (the creating thread's) reference while the other threads are still using theirs. */
+						shared_obj_ptr = nullptr;
+						for (auto& thread : threads) {
+							thread.join();
+						}
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "mse::TAtomicRefCountingPointer (" << number_of_threads << " threads): " << time_span.count() << " seconds.";
+					if (number_of_threads * number_of_loops_per_thread != (*shared_obj_cptr).count()) {
+						std::cout << " unexpected count: " << (*shared_obj_cptr).count() << ".";
+					}
+					std::cout << std::endl;
+				}
+				{
+					class CB {
+					public:
+						static void copy_and_assign(std::shared_ptr<CAtomicCount> shared_obj_ptr, int number_of_loops_per_thread) {
+							std::shared_ptr<CAtomicCount> item_ptr2 = shared_obj_ptr;
+							for (int i = 0; i < number_of_loops_per_thread; i += 1) {
+								std::shared_ptr<CAtomicCount> item_ptr = shared_obj_ptr;
+								item_ptr2 = item_ptr;
+								(*item_ptr2).increment();
+							}
+						}
+					};
+					auto shared_obj_ptr = std::make_shared<CAtomicCount>();
+					auto shared_obj_cptr = std::shared_ptr<const CAtomicCount>(shared_obj_ptr);
+					auto t1 = std::chrono::high_resolution_clock::now();
+					{
+						std::list<std::thread> threads;
+						for (int i = 0; i < number_of_threads; i += 1) {
+							threads.emplace_back(std::thread(CB::copy_and_assign, shared_obj_ptr, number_of_loops_per_thread));
+						}
+						shared_obj_ptr = nullptr;
+						for (auto& thread : threads) {
+							thread.join();
+						}
+					}
+					auto t2 = std::chrono::high_resolution_clock::now();
+					auto time_span = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+					std::cout << "std::shared_ptr (" << number_of_threads << " threads): " << time_span.count() << " seconds.";
+					if (number_of_threads * number_of_loops_per_thread != (*shared_obj_cptr).count()) {
+						std::cout << " unexpected count: " << (*shared_obj_cptr).count() << ".";
+					}
+					std::cout << std::endl;
+				}
+			}
+			std::cout << std::endl;
+		}
+
+		/* Returns the time taken to push_back() the given number of elements into the given vector. */
+		auto time_push_backs = [](auto& vector_ref, size_t number_of_elements) {
+			auto t1 = std::chrono::high_resolution_clock::now();
+			for (size_t j = 0; j < number_of_elements; j += 1) {
+				vector_ref.push_back(int(j));
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			return std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count();
+		};
+		auto push_back_benchmark = [&time_push_backs](auto vector_tag, const char* name, size_t number_of_elements, int number_of_vector_loops) {
+			typedef decltype(vector_tag) vector_type;
+			double push_back_seconds = 0.0;
+			long long sum = 0;
+			for (int i = 0; i < number_of_vector_loops; i += 1) {
+				vector_type v1;
+				push_back_seconds += time_push_backs(v1, number_of_elements);
+				sum += v1.back();
+			}
+			std::cout << name << ": " << push_back_seconds << " seconds.";
+			if (0 == sum) {
+				std::cout << " unexpected sum."; /* Using the sum variable for (potential) output should prevent the optimizer from discarding it. */
+			}
+			std::cout << std::endl;
+		};
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_elements = 10000/*arbitrary*/;
+			static const int number_of_vector_loops = 10/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_elements = 100000/*arbitrary*/;
+			static const int number_of_vector_loops = 100/*arbitrary*/;
+#endif // !NDEBUG
+			std::cout << "vector push_back(), operator[] and iteration (" << number_of_elements << " elements, "
+				<< number_of_vector_loops << " loops): \n";
+
+			auto vector_benchmark = [&time_push_backs](auto vector_tag, const char* name) {
+				typedef decltype(vector_tag) vector_type;
+				double push_back_seconds = 0.0;
+				double subscript_seconds = 0.0;
+				double iteration_seconds = 0.0;
+				long long sum = 0;
+				for (int i = 0; i < number_of_vector_loops; i += 1) {
+					vector_type v1;
+					push_back_seconds += time_push_backs(v1, number_of_elements);
+					auto t2 = std::chrono::high_resolution_clock::now();
+					for (size_t j = 0; j < number_of_elements; j += 1) {
+						sum += v1[j];
+					}
+					auto t3 = std::chrono::high_resolution_clock::now();
+					for (auto iter = v1.begin(); v1.end() != iter; ++iter) {
+						sum += (*iter);
+					}
+					auto t4 = std::chrono::high_resolution_clock::now();
+					subscript_seconds += std::chrono::duration_cast<std::chrono::duration<double>>(t3 - t2).count();
+					iteration_seconds += std::chrono::duration_cast<std::chrono::duration<double>>(t4 - t3).count();
+				}
+				std::cout << name << ": push_back(): " << push_back_seconds << " seconds, operator[]: " << subscript_seconds
+					<< " seconds, iteration: " << iteration_seconds << " seconds.";
+				if (0 == sum) {
+					std::cout << " unexpected sum."; /* Using the sum variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			};
+			vector_benchmark(std::vector<int>(), "std::vector");
+			vector_benchmark(mse::mstd::vector<int>(), "mse::mstd::vector");
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_elements = 10000/*arbitrary*/;
+			static const int number_of_vector_loops = 10/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_elements = 100000/*arbitrary*/;
+			static const int number_of_vector_loops = 100/*arbitrary*/;
+#endif // !NDEBUG
+			std::cout << "vector push_back() (" << number_of_elements << " elements, " << number_of_vector_loops << " loops): \n";
+
+			/* Each push_back() of the "nii" vectors acquires and releases the vector's "structure change" lock. For
+			mtnii_vector<> that lock is thread-safe (atomic). */
+			push_back_benchmark(std::vector<int>(), "std::vector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::nii_vector<int>(), "mse::nii_vector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::stnii_vector<int>(), "mse::stnii_vector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::mtnii_vector<int>(), "mse::mtnii_vector", number_of_elements, number_of_vector_loops);
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_elements = 1000000/*arbitrary*/;
+			static const int number_of_vector_loops = 2/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_elements = 10000000/*arbitrary*/;
+			static const int number_of_vector_loops = 10/*arbitrary*/;
+#endif // !NDEBUG
+			std::cout << "large vector growth (" << number_of_elements << " elements, " << number_of_vector_loops << " loops): \n";
+
+			/* With an allocator like mse::realloc_allocator<> that supports growing an allocation in place (or with realloc()),
+			the vectors grow their storage without necessarily copying the (trivially relocatable) elements. */
+			push_back_benchmark(std::vector<int>(), "std::vector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::nii_vector<int>(), "mse::nii_vector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::nii_vector<int, mse::realloc_allocator<int> >(), "mse::nii_vector (realloc_allocator)", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::us::msevector<int>(), "mse::us::msevector", number_of_elements, number_of_vector_loops);
+			push_back_benchmark(mse::us::msevector<int, mse::realloc_allocator<int> >(), "mse::us::msevector (realloc_allocator)", number_of_elements, number_of_vector_loops);
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const int number_of_loops = 10000/*arbitrary*/;
+#else // !NDEBUG
+			static const int number_of_loops = 1000000/*arbitrary*/;
+#endif // !NDEBUG
+			static const int number_of_ipointers = 20/*arbitrary*/;
+			std::cout << "msevector ipointer creation and destruction, with insert() and erase() (" << number_of_ipointers
+				<< " ipointers, " << number_of_loops << " loops): \n";
+
+			typedef mse::us::msevector<int> msevector_type;
+			msevector_type v1(100/*arbitrary*/, 0);
+			long long sum = 0;
+			auto t1 = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < number_of_loops; i += 1) {
+				std::vector<msevector_type::ipointer> ipointers;
+				ipointers.reserve(number_of_ipointers);
+				for (int j = 0; j < number_of_ipointers; j += 1) {
+					ipointers.emplace_back(v1);
+					ipointers.back().advance(j);
+				}
+				v1.insert(v1.begin() + 1, i);
+				sum += *(ipointers.back());
+				v1.erase(v1.begin() + 1);
+			}
+			auto t2 = std::chrono::high_resolution_clock::now();
+			std::cout << "msevector ipointers: " << std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count() << " seconds.";
+			if (0 != sum) {
+				std::cout << " unexpected sum."; /* Using the sum variable for (potential) output should prevent the optimizer from discarding it. */
+			}
+			std::cout << std::endl;
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const int number_of_loops = 100/*arbitrary*/;
+#else // !NDEBUG
+			static const int number_of_loops = 10000/*arbitrary*/;
+#endif // !NDEBUG
+			static const int number_of_elements = 1000/*arbitrary*/;
+			std::cout << "iteration, with a copied iterator per element (" << number_of_elements << " elements, "
+				<< number_of_loops << " loops): \n";
+
+			/* Each step creates (and destroys) an iterator copy, as (post-increment and) many algorithms do. */
+			auto iteration_benchmark = [](auto& v1, auto begin_fn, const char* name) {
+				long long sum = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < number_of_loops; i += 1) {
+					for (auto iter = begin_fn(v1); iter.points_to_an_item(); iter++) {
+						sum += *iter;
+					}
+				}
+				auto t2 = std::chrono::high_resolution_clock::now();
+				std::cout << name << ": " << std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count() << " seconds.";
+				if (0 != sum) {
+					std::cout << " unexpected sum."; /* Using the sum variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			};
+			mse::us::msevector<int> v1(number_of_elements, 0);
+			iteration_benchmark(v1, [](auto& v) { return v.ss_begin(); }, "mse::us::msevector ss_iterators");
+			iteration_benchmark(v1, [](auto& v) { return v.ibegin(); }, "mse::us::msevector ipointers");
+			mse::ivector<int> iv1(number_of_elements, 0);
+			iteration_benchmark(iv1, [](auto& v) { return v.begin(); }, "mse::ivector ipointers");
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_elements = 10000/*arbitrary*/;
+			static const int number_of_loops = 10/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_elements = 1000000/*arbitrary*/;
+			static const int number_of_loops = 100/*arbitrary*/;
+#endif // !NDEBUG
+			std::cout << "random access section bulk operations, fill(), copy_from() and reduce() (" << number_of_elements
+				<< " elements, " << number_of_loops << " loops): \n";
+
+			/* The elements of a section of a (refcounting pointer to an) mse::nii_array<> are contiguous and stay put, so
+			the bulk operations can work on raw pointers. */
+			auto array_refcptr1 = mse::make_refcounting<mse::nii_array<int, number_of_elements> >();
+			auto array_refcptr2 = mse::make_refcounting<mse::nii_array<int, number_of_elements> >();
+			auto ra_section1 = mse::make_random_access_section(array_refcptr1);
+			auto ra_section2 = mse::make_random_access_section(array_refcptr2);
+			std::vector<int> v1(number_of_elements);
+			std::vector<int> v2(number_of_elements);
+			auto report = [](const char* name, std::chrono::high_resolution_clock::time_point t1, long long sum) {
+				auto t2 = std::chrono::high_resolution_clock::now();
+				std::cout << name << ": " << std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count() << " seconds.";
+				if (sum != (long long)(number_of_loops) * (long long)(number_of_elements)) {
+					std::cout << " unexpected sum."; /* Using the sum variable for (potential) output should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			};
+
+			{
+				long long sum = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						v2[i] = j;
+					}
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						v1[i] = v2[i];
+					}
+					int loop_sum = 0;
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						loop_sum += v1[i] - j + 1;
+					}
+					sum += loop_sum;
+				}
+				report("raw loops over std::vector", t1, sum);
+			}
+			{
+				long long sum = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						ra_section2[i] = j;
+					}
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						ra_section1[i] = ra_section2[i];
+					}
+					int loop_sum = 0;
+					for (size_t i = 0; i < number_of_elements; i += 1) {
+						loop_sum += ra_section1[i] - j + 1;
+					}
+					sum += loop_sum;
+				}
+				report("element by element, via the sections", t1, sum);
+			}
+			{
+				long long sum = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					ra_section2.fill(j);
+					ra_section1.copy_from(ra_section2);
+					sum += ra_section1.reduce(0, [j](int x, int y) { return x + y - j + 1; });
+				}
+				report("section bulk operations", t1, sum);
+			}
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const size_t number_of_elements = 100000/*arbitrary*/;
+			static const int number_of_loops = 2/*arbitrary*/;
+#else // !NDEBUG
+			static const size_t number_of_elements = 10000000/*arbitrary*/;
+			static const int number_of_loops = 10/*arbitrary*/;
+#endif // !NDEBUG
+			const size_t number_of_hardware_threads = std::thread::hardware_concurrency();
+			std::cout << "transforming the elements of a shared vector (" << number_of_elements << " elements, " << number_of_loops
+				<< " loops, hardware_concurrency(): " << number_of_hardware_threads << "): \n";
+
+			typedef mse::mtnii_vector<double> async_shareable_vector1_t;
+			auto ash_access_requester = mse::make_asyncsharedv2readwrite<async_shareable_vector1_t>(number_of_elements, 1.0);
+			typedef mse::TAsyncRASectionSplitter<decltype(ash_access_requester)>::ras_ar_t ras_ar_t;
+			class CB {
+			public:
+				static double next_value(double x) { return x * 0.5 + 1.0; }
+				static void transform_section(ras_ar_t ar) {
+					auto ra_section = ar.writelock_ra_section();
+					for (size_t i = 0; i < ra_section.size(); i += 1) {
+						ra_section[i] = next_value(ra_section[i]);
+					}
+				}
+			};
+			auto report = [&ash_access_requester](const char* name, std::chrono::high_resolution_clock::time_point t1) {
+				auto t2 = std::chrono::high_resolution_clock::now();
+				std::cout << name << ": " << std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count() << " seconds.";
+				/* The repeatedly applied function converges to 2. */
+				auto readlock_ptr = ash_access_requester.readlock_ptr();
+				if ((!(1.0 < (*readlock_ptr).front())) || (!((*readlock_ptr).back() <= 2.0))) {
+					std::cout << " unexpected result."; /* (Potentially) outputting the result should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			};
+
+			{
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					auto writelock_ptr = ash_access_requester.writelock_ptr();
+					auto& vector1 = (*writelock_ptr);
+					for (size_t i = 0; i < vector1.size(); i += 1) {
+						vector1[i] = CB::next_value(vector1[i]);
+					}
+				}
+				report("serial loop", t1);
+			}
+			{
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					mse::parallel_transform(ash_access_requester, CB::next_value);
+				}
+				report("mse::parallel_transform()", t1);
+			}
+			{
+				/* Splitting the vector into one section per hardware thread, and creating a thread for each section. */
+				const size_t num_sections = (1 <= number_of_hardware_threads) ? number_of_hardware_threads : 1;
+				std::vector<size_t> section_sizes(num_sections, number_of_elements / num_sections);
+				for (size_t i = 0; i < number_of_elements % num_sections; i += 1) {
+					section_sizes[i] += 1;
+				}
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					mse::TAsyncRASectionSplitter<decltype(ash_access_requester)> ra_section_split1(ash_access_requester, section_sizes);
+					std::list<mse::mstd::thread> threads;
+					for (size_t i = 0; i < num_sections; i += 1) {
+						threads.emplace_back(mse::mstd::thread(CB::transform_section, ra_section_split1.ra_section_access_requester(i)));
+					}
+					for (auto& thread : threads) {
+						thread.join();
+					}
+				}
+				report("mse::TAsyncRASectionSplitter<> and mse::mstd::thread", t1);
+			}
+			std::cout << std::endl;
+		}
+
+		{
+#ifndef NDEBUG
+			static const int number_of_loops = 1000/*arbitrary*/;
+#else // !NDEBUG
+			static const int number_of_loops = 100000/*arbitrary*/;
+#endif // !NDEBUG
+			static const size_t number_of_elements = 1000/*arbitrary*/;
+			static const size_t number_of_sections = 4;
+			std::cout << "splitting a vector into sections and obtaining their access requesters (" << number_of_sections
+				<< " sections, " << number_of_loops << " loops): \n";
+
+			typedef mse::mtnii_vector<double> async_shareable_vector1_t;
+			mse::TXScopeObj<mse::TXScopeAccessControlledObj<async_shareable_vector1_t> > xscope_acobj(number_of_elements, 1.0);
+			auto report = [](const char* name, std::chrono::high_resolution_clock::time_point t1, size_t total_size) {
+				auto t2 = std::chrono::high_resolution_clock::now();
+				std::cout << name << ": " << std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count() << " seconds.";
+				if (size_t(number_of_loops) * number_of_elements != total_size) {
+					std::cout << " unexpected total size."; /* (Potentially) outputting the result should prevent the optimizer from discarding it. */
+				}
+				std::cout << std::endl;
+			};
+
+			{
+				const std::vector<size_t> section_sizes(number_of_sections, number_of_elements / number_of_sections);
+				size_t total_size = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					mse::TXScopeAsyncACORASectionSplitter<async_shareable_vector1_t> xscope_ra_section_split1(&xscope_acobj, section_sizes);
+					for (size_t i = 0; i < number_of_sections; i += 1) {
+						auto ar = xscope_ra_section_split1.ra_section_access_requester(i);
+						total_size += ar.readlock_ra_section().size();
+					}
+				}
+				report("mse::TXScopeAsyncACORASectionSplitter<> (with a vector of section sizes)", t1, total_size);
+			}
+			{
+				size_t total_size = 0;
+				auto t1 = std::chrono::high_resolution_clock::now();
+				for (int j = 0; j < number_of_loops; j += 1) {
+					mse::TXScopeAsyncNWayRASectionSplitterXWP<decltype(xscope_acobj.exclusive_pointer()), number_of_sections> xscope_ra_section_split1(xscope_acobj.exclusive_pointer());
+					for (size_t i = 0; i < number_of_sections; i += 1) {
+						auto ar = xscope_ra_section_split1.ra_section_access_requester(i);
+						total_size += ar.readlock_ra_section().size();
+					}
+				}
+				report("mse::TXScopeAsyncNWayRASectionSplitterXWP<>", t1, total_size);
+			}
+			std::cout << std::endl;
+		}
 	}
 
 	msetl_example2();
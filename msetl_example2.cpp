@@ -16,6 +16,7 @@
 #include "msemsearray.h"
 #include "msemstdarray.h"
 #include "msemsevector.h"
+#include "msesegmentedvector.h"
 #include "msemstdvector.h"
 #include "msemsestring.h"
 #include "msemstdstring.h"
@@ -29,6 +30,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <deque>
 
 
 #ifdef _MSC_VER
@@ -54,6 +56,45 @@
 #endif /*__GNUC__*/
 #endif /*__clang__*/
 
+/* An allocator that reserves room for twice the requested number of elements, and records the actual capacity in a
+header before the elements, so that its try_expand() member can (sometimes) grow an allocation in place. Used to
+demonstrate (and exercise) the vectors' use of the allocator's try_expand() member when present. */
+template<typename _Ty>
+class CHeadroomAllocator {
+public:
+	typedef _Ty value_type;
+
+	CHeadroomAllocator() {}
+	template<typename _Ty2>
+	CHeadroomAllocator(const CHeadroomAllocator<_Ty2>&) {}
+
+	_Ty* allocate(size_t n) {
+		const size_t capacity = 2 * ((0 == n) ? 1 : n);
+		char* block_ptr = static_cast<char*>(::operator new(header_size() + capacity * sizeof(_Ty)));
+		*reinterpret_cast<size_t*>(block_ptr) = capacity;
+		return reinterpret_cast<_Ty*>(block_ptr + header_size());
+	}
+	void deallocate(_Ty* p, size_t) { ::operator delete(reinterpret_cast<char*>(p) - header_size()); }
+	bool try_expand(_Ty* p, size_t /*n*/, size_t new_n) {
+		if (*reinterpret_cast<const size_t*>(reinterpret_cast<char*>(p) - header_size()) < new_n) { return false; }
+		num_expansions() += 1;
+		return true;
+	}
+
+	template<typename _Ty2>
+	bool operator==(const CHeadroomAllocator<_Ty2>&) const { return true; }
+	template<typename _Ty2>
+	bool operator!=(const CHeadroomAllocator<_Ty2>&) const { return false; }
+
+	static size_t& num_expansions() {
+		static size_t s_num_expansions = 0;
+		return s_num_expansions;
+	}
+
+private:
+	static size_t header_size() { return (alignof(std::max_align_t) >= sizeof(size_t)) ? alignof(std::max_align_t) : sizeof(size_t); }
+};
+
 class J {
 public:
 	template<typename _TParam>
@@ -343,6 +384,294 @@ void msetl_example2() {
 		}
 	}
 
+	{
+		/***************************/
+		/*   realloc_allocator<>   */
+		/***************************/
+
+		/* With an allocator like mse::realloc_allocator<> that provides the (optional) try_expand() and/or reallocate()
+		members, the library's vectors use those members when growing their storage. */
+
+		static const std::string suffix = " - a string long enough to need its own heap allocation";
+		{
+			/* std::string isn't (designated as) trivially relocatable, so the elements are moved individually whenever
+			the storage needs to be relocated. */
+			typedef mse::us::msevector<std::string, mse::realloc_allocator<std::string> > string_vector_t;
+			string_vector_t vector1;
+			for (int i = 0; i < 20; i += 1) {
+				vector1.push_back(std::to_string(i) + suffix);
+			}
+			vector1.insert(vector1.begin() + 5, 3, std::string("inserted"));
+			assert((23 == vector1.size()) && ("inserted" == vector1[7]) && (std::to_string(5) + suffix == vector1[8]));
+			vector1.erase(vector1.begin() + 5, vector1.begin() + 8);
+			assert((20 == vector1.size()) && (std::to_string(5) + suffix == vector1[5]));
+			vector1.erase(vector1.begin() + 10, vector1.end());
+			vector1.shrink_to_fit();
+			assert((10 == vector1.size()) && (10 == vector1.capacity()) && (std::to_string(9) + suffix == vector1.back()));
+
+			string_vector_t vector2 = vector1;
+			assert(vector1 == vector2);
+			string_vector_t vector3 = std::move(vector2);
+			assert(vector1 == vector3);
+			vector2 = vector3;
+			vector3 = std::move(vector2);
+			assert((vector1 == vector3) && (std::to_string(0) + suffix == vector3.front()));
+		}
+		{
+			/* int is trivially relocatable, so the storage can be grown with the allocator's reallocate() member. */
+			typedef mse::nii_vector<int, mse::realloc_allocator<int> > int_vector_t;
+			mse::TXScopeObj<int_vector_t> vector1_xscpobj;
+			for (int i = 0; i < 1000; i += 1) {
+				vector1_xscpobj.push_back(i);
+			}
+			int_vector_t::insert(&vector1_xscpobj, 5, 3, -1);
+			assert((1003 == vector1_xscpobj.size()) && (-1 == vector1_xscpobj[7]) && (5 == vector1_xscpobj[8]));
+			int_vector_t::erase(&vector1_xscpobj, 5, 8);
+			assert((1000 == vector1_xscpobj.size()) && (5 == vector1_xscpobj[5]));
+			vector1_xscpobj.resize(10);
+			vector1_xscpobj.shrink_to_fit();
+			assert((10 == vector1_xscpobj.size()) && (10 == vector1_xscpobj.capacity()) && (9 == vector1_xscpobj.back()));
+
+			mse::TXScopeObj<int_vector_t> vector2_xscpobj = vector1_xscpobj;
+			assert(vector1_xscpobj == vector2_xscpobj);
+			mse::TXScopeObj<int_vector_t> vector3_xscpobj = std::move(vector2_xscpobj);
+			assert(vector1_xscpobj == vector3_xscpobj);
+		}
+		{
+			/* An allocator whose try_expand() can succeed allows (some of) the growth to happen in place. */
+			mse::TXScopeObj<mse::nii_vector<std::string, CHeadroomAllocator<std::string> > > vector1_xscpobj;
+			const auto num_expansions_before = CHeadroomAllocator<std::string>::num_expansions();
+			for (int i = 0; i < 100; i += 1) {
+				vector1_xscpobj.push_back(std::to_string(i) + suffix);
+			}
+			assert(num_expansions_before < CHeadroomAllocator<std::string>::num_expansions());
+			for (int i = 0; i < 100; i += 1) {
+				assert(std::to_string(i) + suffix == vector1_xscpobj[i]);
+			}
+		}
+	}
+
+	{
+		/*****************************************************/
+		/*   nii_small_vector<> and stnii_small_vector<>   */
+		/*****************************************************/
+
+		/* nii_small_vector<> and stnii_small_vector<> are versions of nii_vector<> and stnii_vector<> that store up to
+		a specified number of elements inline (i.e. without a heap allocation). Only when the size of the vector exceeds
+		that number are the elements moved to heap storage. They otherwise have the same interface and safety mechanisms. */
+
+		mse::TXScopeObj<mse::stnii_small_vector<int, 4> > vector1_xscpobj = mse::stnii_small_vector<int, 4>{ 3, 2, 1 };
+		{
+			auto xscp_iter1 = mse::make_xscope_begin_iterator(&vector1_xscpobj);
+			auto xscp_iter2 = mse::make_xscope_end_iterator(&vector1_xscpobj);
+			std::sort(xscp_iter1, xscp_iter2);
+
+			/* As with stnii_vector<>, the structure of the vector is locked while the scope iterators exist, so the
+			elements cannot be relocated (to the heap or otherwise) while scope pointers to them are outstanding. */
+			auto xscp_ptr1 = mse::xscope_pointer(xscp_iter1);
+			assert(1 == *xscp_ptr1);
+			MSE_TRY {
+				vector1_xscpobj.push_back(4);
+				assert(false);
+			}
+			MSE_CATCH_ANY {
+				/* expected exception */
+			}
+		}
+		{
+			mse::TXScopeFixedConstPointer<mse::stnii_small_vector<int, 4> > xscptr = &vector1_xscpobj;
+			auto xscp_citer1 = mse::make_xscope_begin_const_iterator(xscptr);
+			xscp_citer1 += 2;
+			auto xscp_cptr1 = mse::xscope_const_pointer(xscp_citer1);
+			assert(3 == *xscp_cptr1);
+		}
+		/* Growing past the inline capacity moves the elements to the heap. */
+		for (int i = 4; i < 10; i += 1) {
+			vector1_xscpobj.push_back(i);
+		}
+		assert(9 == vector1_xscpobj.size());
+
+		mse::TXScopeObj<mse::nii_small_vector<int, 4> > vector2_xscpobj = mse::nii_small_vector<int, 4>{ 1, 2, 3 };
+		{
+			auto xscp_lock_guard1 = mse::make_xscope_structure_lock_guard(&vector2_xscpobj);
+			auto xscp_ptr1 = xscp_lock_guard1.xscope_ptr_to_element(1);
+			assert(2 == *xscp_ptr1);
+		}
+		vector2_xscpobj.push_back(4);
+
+		{
+			/* Elements that aren't trivially relocatable (like std::string) are moved individually when they're
+			relocated between the inline and heap storage. */
+			static const std::string suffix = " - a string long enough to need its own heap allocation";
+			auto str = [](int i) { return std::to_string(i) + suffix; };
+			typedef mse::nii_small_vector<std::string, 4> string_vector_t;
+			mse::TXScopeObj<string_vector_t> vector3_xscpobj = string_vector_t{ str(0), str(1), str(2) };
+			for (int i = 3; i < 10; i += 1) {
+				vector3_xscpobj.push_back(str(i));
+			}
+			assert((10 == vector3_xscpobj.size()) && (4 < vector3_xscpobj.capacity()));
+			for (int i = 0; i < 10; i += 1) {
+				assert(str(i) == vector3_xscpobj[i]);
+			}
+			/* Shrinking back to (no more than) the inline capacity moves the elements back to the inline storage. */
+			vector3_xscpobj.resize(3);
+			vector3_xscpobj.shrink_to_fit();
+			assert((3 == vector3_xscpobj.size()) && (4 == vector3_xscpobj.capacity()) && (str(2) == vector3_xscpobj[2]));
+
+			/* Swapping (and moving) between a vector with inline elements and one with heap elements. */
+			mse::TXScopeObj<string_vector_t> vector4_xscpobj = string_vector_t{ str(10), str(11), str(12), str(13), str(14), str(15) };
+			vector3_xscpobj.swap(vector4_xscpobj);
+			assert((6 == vector3_xscpobj.size()) && (str(15) == vector3_xscpobj[5]));
+			assert((3 == vector4_xscpobj.size()) && (4 == vector4_xscpobj.capacity()) && (str(0) == vector4_xscpobj[0]));
+			mse::TXScopeObj<string_vector_t> vector5_xscpobj = std::move(vector4_xscpobj);
+			assert((3 == vector5_xscpobj.size()) && (str(2) == vector5_xscpobj[2]));
+			vector5_xscpobj = std::move(vector3_xscpobj);
+			assert((6 == vector5_xscpobj.size()) && (str(10) == vector5_xscpobj[0]));
+
+			mse::TXScopeObj<mse::stnii_small_vector<std::string, 4> > vector6_xscpobj = mse::stnii_small_vector<std::string, 4>{ str(0), str(1) };
+			mse::TXScopeObj<mse::stnii_small_vector<std::string, 4> > vector7_xscpobj;
+			for (int i = 0; i < 8; i += 1) {
+				vector7_xscpobj.push_back(str(i));
+			}
+			vector6_xscpobj.swap(vector7_xscpobj);
+			assert((8 == vector6_xscpobj.size()) && (str(7) == vector6_xscpobj[7]));
+			assert((2 == vector7_xscpobj.size()) && (str(1) == vector7_xscpobj[1]));
+			vector7_xscpobj = std::move(vector6_xscpobj);
+			assert((8 == vector7_xscpobj.size()) && (str(7) == vector7_xscpobj[7]));
+		}
+		{
+			/* If relocating the elements fails partway (here, because copying an element throws), the elements already
+			constructed in the new storage are destroyed and the new storage is released, leaving the vector unchanged. */
+			class CThrowingCopy {
+			public:
+				CThrowingCopy(const std::string& str, int* countdown_ptr) : m_str(str), m_countdown_ptr(countdown_ptr) {}
+				/* With no (noexcept) move constructor, the elements are copied when relocated. */
+				CThrowingCopy(const CThrowingCopy& src) : m_str(src.m_str), m_countdown_ptr(src.m_countdown_ptr) {
+					if (0 == (*m_countdown_ptr)) { throw std::runtime_error("copy failed"); }
+					(*m_countdown_ptr) -= 1;
+				}
+				CThrowingCopy& operator=(const CThrowingCopy& src) = default;
+				std::string m_str;
+				int* m_countdown_ptr = nullptr;
+			};
+			int countdown = 100;
+			mse::TXScopeObj<mse::nii_small_vector<CThrowingCopy, 4> > vector8_xscpobj;
+			for (int i = 0; i < 4; i += 1) {
+				vector8_xscpobj.push_back(CThrowingCopy(std::to_string(i), &countdown));
+			}
+			countdown = 2;
+			MSE_TRY {
+				vector8_xscpobj.push_back(CThrowingCopy("4", &countdown));
+				assert(false);
+			}
+			MSE_CATCH_ANY {
+				/* expected exception */
+			}
+			assert((4 == vector8_xscpobj.size()) && (4 == vector8_xscpobj.capacity()));
+			for (int i = 0; i < 4; i += 1) {
+				assert(std::to_string(i) == vector8_xscpobj[i].m_str);
+			}
+		}
+	}
+
+	{
+		/**************************/
+		/*   segmented_vector<>   */
+		/**************************/
+
+		/* segmented_vector<> stores its elements in fixed-size segments, so adding elements never moves the existing
+		ones. So unlike with the other vectors, a structure lock only prevents the removal of elements, and adding
+		elements remains permitted while (scope) pointers to elements exist. */
+
+		mse::TXScopeObj<mse::segmented_vector<int, 4> > vector1_xscpobj = mse::segmented_vector<int, 4>{ 3, 2, 1 };
+		{
+			auto xscp_iter1 = mse::make_xscope_begin_iterator(&vector1_xscpobj);
+			auto xscp_iter2 = mse::make_xscope_end_iterator(&vector1_xscpobj);
+			std::sort(xscp_iter1, xscp_iter2);
+
+			auto xscp_section1 = mse::make_xscope_random_access_section(xscp_iter1, 2);
+			assert(2 == xscp_section1[1]);
+		}
+		{
+			auto xscp_lock_guard1 = mse::make_xscope_structure_lock_guard(&vector1_xscpobj);
+			auto xscp_ptr1 = xscp_lock_guard1.xscope_ptr_to_element(1);
+			assert(2 == *xscp_ptr1);
+
+			/* Growing the vector doesn't affect the element the scope pointer points to. */
+			for (int i = 4; i < 100; i += 1) {
+				vector1_xscpobj.push_back(i);
+			}
+			assert(2 == *xscp_ptr1);
+
+			/* But removing elements is not permitted while the structure is locked. */
+			MSE_TRY {
+				vector1_xscpobj.pop_back();
+				assert(false);
+			}
+			MSE_CATCH_ANY {
+				/* expected exception */
+			}
+		}
+		vector1_xscpobj.pop_back();
+		assert(98 == vector1_xscpobj.size());
+
+		{
+			/* Insertions, removals and resizing (with a small segment size, so that they span segment boundaries) yield
+			the same results as they would with std::vector<>. */
+			mse::segmented_vector<int, 3> vector2;
+			std::vector<int> std_vector2;
+			auto same_contents = [&vector2, &std_vector2]() {
+				if (vector2.size() != std_vector2.size()) { return false; }
+				for (size_t i = 0; i < std_vector2.size(); i += 1) {
+					if (vector2[i] != std_vector2[i]) { return false; }
+				}
+				return true;
+			};
+			for (int i = 0; i < 10; i += 1) {
+				vector2.push_back(i);
+				std_vector2.push_back(i);
+			}
+			vector2.insert(2, 100);
+			std_vector2.insert(std_vector2.begin() + 2, 100);
+			assert(same_contents());
+			vector2.insert(4, 5, 200);
+			std_vector2.insert(std_vector2.begin() + 4, 5, 200);
+			assert(same_contents());
+			vector2.insert(0, { 300, 301, 302, 303 });
+			std_vector2.insert(std_vector2.begin(), { 300, 301, 302, 303 });
+			assert(same_contents());
+			vector2.insert(vector2.size(), 400);
+			std_vector2.insert(std_vector2.end(), 400);
+			assert(same_contents());
+			vector2.erase(1);
+			std_vector2.erase(std_vector2.begin() + 1);
+			assert(same_contents());
+			vector2.erase(2, 9);
+			std_vector2.erase(std_vector2.begin() + 2, std_vector2.begin() + 9);
+			assert(same_contents());
+			vector2.resize(5);
+			std_vector2.resize(5);
+			assert(same_contents());
+			vector2.resize(11, 500);
+			std_vector2.resize(11, 500);
+			assert(same_contents());
+			vector2.resize(1);
+			std_vector2.resize(1);
+			assert(same_contents());
+		}
+		{
+			mse::TXScopeObj<mse::segmented_vector<int, 3> > vector3_xscpobj = mse::segmented_vector<int, 3>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+			auto xscp_lock_guard1 = mse::make_xscope_structure_lock_guard(&vector3_xscpobj);
+			auto xscp_ptr1 = xscp_lock_guard1.xscope_ptr_to_element(4);
+			assert(4 == *xscp_ptr1);
+
+			/* Insertion is permitted while the structure is locked, but (as with std::vector<>) it shifts the values of
+			the subsequent elements. So the scope pointer (still valid) now sees the value that preceded it. */
+			vector3_xscpobj.insert(2, 100);
+			assert((3 == *xscp_ptr1) && (4 == vector3_xscpobj[5]) && (11 == vector3_xscpobj.size()));
+		}
+	}
+
 	{
 		/*******************/
 		/*  Poly pointers  */
@@ -944,6 +1273,70 @@ void msetl_example2() {
 		auto xscp_ra_section3 = mse::random_access_subsection(xscp_ra_section1, std::make_tuple(0, xscp_ra_section1.length()/2));
 		assert(xscp_ra_section3.length() == 1);
 
+		{
+			/* Random access sections also support some "bulk" operations (fill(), copy_from(), transform(), reduce() and
+			compare()) that check bounds once per call rather than on every element access. */
+			mse::TXScopeObj<mse::nii_array<int, 6> > xscp_nii_array1 = mse::nii_array<int, 6>{ 1, 2, 3, 4, 5, 6 };
+			auto xscp_ra_section4 = mse::make_xscope_random_access_section(&xscp_nii_array1);
+			auto xscp_ra_section5 = mse::make_xscope_subsection(xscp_ra_section4, 3, 3);
+
+			xscp_ra_section5.copy_from(mse::make_xscope_subsection(xscp_ra_section4, 0, 3));
+			assert(0 == xscp_ra_section5.compare(mse::make_xscope_subsection(xscp_ra_section4, 0, 3)));
+			xscp_ra_section5.transform(xscp_ra_section5, [](int x) { return 10 * x; });
+			assert(0 > xscp_ra_section4.compare(xscp_ra_section5));
+			auto sum1 = xscp_ra_section4.reduce(0);
+			assert(66 == sum1);
+			xscp_ra_section4.fill(0);
+			assert(0 == xscp_ra_section4.reduce(0));
+
+			/* The source and target of copy_from() may overlap (in either direction). */
+			mse::TXScopeObj<mse::nii_array<int, 6> > xscp_nii_array2 = mse::nii_array<int, 6>{ 1, 2, 3, 4, 5, 6 };
+			xscp_ra_section4.copy_from(&xscp_nii_array2);
+			mse::make_xscope_subsection(xscp_ra_section4, 2).copy_from(mse::make_xscope_subsection(xscp_ra_section4, 0, 4));
+			xscp_nii_array2 = mse::nii_array<int, 6>{ 1, 2, 1, 2, 3, 4 };
+			assert(0 == xscp_ra_section4.compare(&xscp_nii_array2));
+			xscp_ra_section4.copy_from(mse::make_xscope_subsection(xscp_ra_section4, 1));
+			xscp_nii_array2 = mse::nii_array<int, 6>{ 2, 1, 2, 3, 4, 4 };
+			assert(0 == xscp_ra_section4.compare(&xscp_nii_array2));
+
+			/* As may the source and target of transform(). */
+			mse::make_xscope_subsection(xscp_ra_section4, 1).transform(mse::make_xscope_subsection(xscp_ra_section4, 0, 5), [](int x) { return x + 1; });
+			xscp_nii_array2 = mse::nii_array<int, 6>{ 2, 3, 2, 3, 4, 5 };
+			assert(0 == xscp_ra_section4.compare(&xscp_nii_array2));
+		}
+
+		{
+			/* Sections over containers whose elements are not contiguous, or may be relocated (such as a std::deque<> or
+			std::vector<> accessed via a refcounting pointer), access their elements via the (bounds checked) iterator. This
+			is the case even when some of the safe iterator types are disabled (with MSE_MSTDVECTOR_DISABLED, for example). */
+			auto deque_refcptr1 = mse::make_refcounting<std::deque<int> >();
+			for (int i = 0; i < 2000; i += 1) { deque_refcptr1->push_back(i); }
+			auto ra_section6 = mse::make_random_access_section(mse::make_random_access_iterator(deque_refcptr1, 0), 2000);
+			assert(1500 == ra_section6[1500]);
+
+			/* The bulk operations also work via the iterator in this case. */
+			assert(1999 * 1000 == ra_section6.reduce(0L));
+			auto ra_section6b = mse::make_subsection(ra_section6, 1000, 500);
+			ra_section6b.fill(-1);
+			assert(-500L == ra_section6b.reduce(0L));
+			ra_section6b.transform(mse::make_subsection(ra_section6, 0, 500), [](int x) { return x + 1000; });
+			assert(0 == ra_section6.compare(mse::make_random_access_const_section(mse::make_random_access_const_iterator(deque_refcptr1, 0), 2000)));
+			assert(1499 == ra_section6[1499]);
+
+			/* Overlapping copies (spanning many of the deque's internal blocks) in both directions. */
+			mse::make_subsection(ra_section6, 300).copy_from(mse::make_subsection(ra_section6, 0, 1500));
+			assert((299 == ra_section6[299]) && (0 == ra_section6[300]) && (1499 == ra_section6[1799]) && (1800 == ra_section6[1800]));
+			ra_section6.copy_from(mse::make_subsection(ra_section6, 300));
+			assert((0 == ra_section6[0]) && (1499 == ra_section6[1499]) && (1800 == ra_section6[1500]));
+			mse::make_subsection(ra_section6, 1).transform(mse::make_subsection(ra_section6, 0, 1499), [](int x) { return 2 * x; });
+			assert((0 == ra_section6[1]) && (2 == ra_section6[2]) && (2996 == ra_section6[1499]) && (1800 == ra_section6[1500]));
+
+			auto vector_refcptr1 = mse::make_refcounting<std::vector<int> >(4, 7);
+			auto ra_section7 = mse::make_random_access_section(mse::make_random_access_iterator(vector_refcptr1, 0), 4);
+			vector_refcptr1->reserve(1000);
+			assert(7 == ra_section7[2]);
+		}
+
 #ifndef EXCLUDE_DUE_TO_MSVC2019_INTELLISENSE_BUGS1
 		{
 			/* In this block we demonstrate the rsv::TXScopeFParam<> specializations that enable passing temporary objects to
@@ -1430,6 +1823,37 @@ void msetl_example2() {
 			auto xscope_pointer5 = mse::xscope_range_get_ref_to_element_known_to_be_present_ptr(&xscope_na1, [](const auto x_ptr) { return 2 == *x_ptr; });
 			auto res5 = *xscope_pointer5;
 		}
+		{
+			/* sort(), copy() and transform() */
+
+			/* TRAIterator<>s that hold a strong pointer to a (contiguous) container whose size can't change, like
+			nii_array<>, are bounds checked once per call (rather than once per element access), after which the
+			algorithm operates on raw pointers. This applies to the corresponding standard algorithms as well. */
+			auto na_refcptr1 = mse::make_refcounting<mse::nii_array<int, 5> >(mse::nii_array<int, 5>{ 5, 3, 4, 1, 2 });
+			auto na_refcptr2 = mse::make_refcounting<mse::nii_array<int, 5> >();
+			auto ra_begin_iter1 = mse::make_random_access_iterator(na_refcptr1, 0);
+			auto ra_end_iter1 = mse::make_random_access_iterator(na_refcptr1, 5);
+			auto ra_begin_iter2 = mse::make_random_access_iterator(na_refcptr2, 0);
+
+			std::sort(ra_begin_iter1, ra_end_iter1);
+			assert(1 == (*na_refcptr1)[0]);
+			auto ra_end_iter2 = std::copy(ra_begin_iter1, ra_end_iter1, ra_begin_iter2);
+			assert(5 == (ra_end_iter2 - ra_begin_iter2));
+			assert(5 == (*na_refcptr2)[4]);
+			mse::transform(ra_begin_iter1, ra_end_iter1, ra_begin_iter2, [](int x) { return 2 * x; });
+			assert(10 == (*na_refcptr2)[4]);
+
+			/* The destination range is bounds checked too. */
+			auto na_refcptr3 = mse::make_refcounting<mse::nii_array<int, 3> >();
+			auto ra_begin_iter3 = mse::make_random_access_iterator(na_refcptr3, 0);
+			try {
+				std::copy(ra_begin_iter1, ra_end_iter1, ra_begin_iter3);
+				assert(false);
+			}
+			catch (...) {
+				// expected exception
+			}
+		}
 	}
 
 	{
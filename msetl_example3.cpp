@@ -99,6 +99,29 @@ public:
 	static void invoke_with_writelock_ra_section1(TAsyncSplitterRASectionReadWriteAccessRequester ar, const TFunction function1, Args&&... args) {
 		function1(ar.writelock_ra_section(), args...);
 	}
+	/* This function just sets each element of the given random access section to a string containing its index. */
+	template<class _TStringRASection>
+	static void foo10(_TStringRASection ra_section) {
+		for (size_t i = 0; i < ra_section.size(); i += 1) {
+			ra_section[i] = "section element " + std::to_string(i);
+		}
+	}
+	static mse::mtnii_string append_exclamation_mark(const mse::mtnii_string& str) {
+		return mse::mtnii_string(str + "!");
+	}
+	/* This function object appends the number of times it has been invoked. Since it has (mutable) state, it would not be
+	safe for multiple threads to invoke the same instance simultaneously. But it is safe to pass a copy to each thread. */
+	class CAppendInvocationCount {
+	public:
+		mse::mtnii_string operator()(const mse::mtnii_string& str) {
+			auto retval = mse::mtnii_string(str + std::to_string(m_invocation_count).c_str());
+			m_invocation_count += 1;
+			return retval;
+		}
+		void async_passable_tag() const {} /* Indication that this type is eligible to be passed between threads. */
+	private:
+		size_t m_invocation_count = 0;
+	};
 	/* This function just obtains an xscope_random_access_section from the given access controlled pointer and calls the given
 	function with the xscope_random_access_section as the first argument. */
 	template<class Ty, class TFunction, class... Args>
@@ -464,6 +487,29 @@ void msetl_example3() {
 				}
 			}
 
+			std::cout << "mse::parallel_for_each_section(): " << std::endl;
+			{
+				/* Rather than choosing section sizes and creating threads ourselves, we can let parallel_for_each_section()
+				split the vector into (by default, one per hardware thread) sections of (nearly) equal size and process
+				them using a pool of reusable threads. The vector remains exclusively locked until all the sections have
+				been processed. */
+				typedef mse::TAsyncRASectionSplitter<decltype(ash_access_requester)>::ras_ar_t ras_ar_t;
+				const auto my_foo10_function = K::foo10<decltype(std::declval<ras_ar_t>().writelock_ra_section())>;
+				mse::parallel_for_each_section(ash_access_requester, my_foo10_function);
+
+				/* parallel_transform() replaces each element with the result of the given function applied to it. Here we
+				also explicitly specify the number of sections. */
+				mse::parallel_transform(ash_access_requester, K::append_exclamation_mark, num_sections);
+
+				assert(mse::mtnii_string("section element 0!") == (*(ash_access_requester.readlock_ptr()))[0]);
+
+				/* Each section is processed with its own copy of the given function object, so function objects with
+				(mutable) state need only be passable, not shareable. */
+				mse::parallel_transform(ash_access_requester, K::CAppendInvocationCount(), num_sections);
+
+				assert(mse::mtnii_string("section element 0!0") == (*(ash_access_requester.readlock_ptr()))[0]);
+			}
+
 			/* Now that we're done sharing the (controlled access) vector, we can swap it back to our original vector. */
 			std::swap(vector1, (*(ash_access_requester.writelock_ptr())));
 			auto first_element_value = vector1[0];
@@ -767,6 +813,44 @@ void msetl_example3() {
 				}
 			}
 
+			std::cout << "mse::TXScopeAsyncNWayRASectionSplitterXWP<>: " << std::endl;
+
+			{
+				/* When the number of sections is known at compile-time, TXScopeAsyncNWayRASectionSplitterXWP<> can be used
+				instead. It splits the vector into (here, four) sections of (nearly) equal size, and stores the sections and
+				their access requesters in std::arrays. */
+				mse::TXScopeAsyncNWayRASectionSplitterXWP<decltype(xscope_acobj.exclusive_pointer()), 4> xscope_ra_section_split1(xscope_acobj.exclusive_pointer());
+				auto ar0 = xscope_ra_section_split1.ra_section_access_requester(0);
+
+				const auto my_foo10_function = K::foo10<decltype(ar0.writelock_ra_section())>;
+				typedef decltype(my_foo10_function) my_foo10_function_type;
+				const auto my_foo10_proxy_function = K::invoke_with_writelock_ra_section1<decltype(ar0), my_foo10_function_type>;
+
+				{
+					mse::xscope_thread_carrier xscope_threads;
+					for (size_t i = 0; i < xscope_ra_section_split1.number_of_sections(); i += 1) {
+						auto ar = xscope_ra_section_split1.ra_section_access_requester(i);
+						xscope_threads.new_thread(my_foo10_proxy_function, ar, my_foo10_function);
+					}
+				}
+
+				/* The sections (together) span the whole vector, their sizes differ by at most one, and each has been
+				written by K::foo10(). */
+				size_t total_size = 0;
+				size_t min_section_size = num_elements;
+				size_t max_section_size = 0;
+				for (size_t i = 0; i < xscope_ra_section_split1.number_of_sections(); i += 1) {
+					auto ra_section = xscope_ra_section_split1.ra_section_access_requester(i).readlock_ra_section();
+					total_size += ra_section.size();
+					min_section_size = std::min(min_section_size, size_t(ra_section.size()));
+					max_section_size = std::max(max_section_size, size_t(ra_section.size()));
+					for (size_t j = 0; j < ra_section.size(); j += 1) {
+						assert(mse::mtnii_string("section element " + std::to_string(j)) == ra_section[j]);
+					}
+				}
+				assert((num_elements == total_size) && (max_section_size - min_section_size <= 1));
+			}
+
 			/* Now that we're done sharing the (controlled access) vector, we can swap it back to our original vector. */
 			std::swap(vector1, *(xscope_acobj.xscope_pointer()));
 			auto first_element_value = vector1[0];
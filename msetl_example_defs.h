@@ -71,6 +71,11 @@ them to be enabled. */
 #endif /*(1910 > _MSC_VER)*/
 #endif /*_MSC_VER*/
 
+/* In debug mode, using an mstd::vector<> iterator after its target vector has been destroyed results in a failed
+assert (before the exception is thrown). The examples deliberately do this (to demonstrate the exception), so the
+following suppresses the assert. */
+#define MSE_SUPPRESS_MSTD_VECTOR_CHECK_USE_AFTER_FREE
+
 #define MSE_SELF_TESTS
 
 #if (1916 <= _MSC_VER) && !defined(MSETL_IGNORE_INTELLISENSE_BUGS)